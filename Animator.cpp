@@ -0,0 +1,146 @@
+/*
+ * Animator.cpp
+ *
+ *  Created on: Oct 18, 2026
+ *      Author: Steven F. LeBrun
+ */
+
+#include "Animator.h"
+
+Animator::Animator( Tween * pool, uint16_t size ) :
+	tweens(pool), capacity(size), count(0), lastTime(Clock::millis())
+{
+}
+
+int Animator::add( int16_t from, int16_t to, unsigned long ms, uint8_t curve, uint8_t mode )
+{
+	if ( count >= capacity )
+	{
+		return -1;
+	}
+
+	set( tweens[count], from, to, ms, curve, mode );
+
+	return count++;
+}
+
+void Animator::update()
+{
+	unsigned long  now     = Clock::millis();
+	unsigned long  elapsed = now - lastTime;
+
+	lastTime = now;
+
+	update( tweens, count, ( elapsed > Animator_MAX_STEP_MS ) ? Animator_MAX_STEP_MS : (uint16_t) elapsed );
+}
+
+void Animator::set( Tween & tween, int16_t from, int16_t to, unsigned long ms, uint8_t curve, uint8_t mode )
+{
+	tween.phase = 0;
+	// Rounded up, so the phase passes its end after exactly ms.
+	tween.rate  = ( ms > 1 ) ? 0xFFFFFFFFUL / ms + 1 : 0xFFFFFFFFUL;
+	tween.from  = from;
+	tween.to    = to;
+	tween.value = from;
+	tween.curve = curve;
+	tween.flags = mode & Tween_MODE;
+}
+
+void Animator::update( Tween * tweens, uint16_t n, uint16_t elapsed )
+{
+	Tween *   tween;
+	Tween *   end = tweens + n;
+	uint32_t  fastest;
+
+	if ( elapsed == 0 )
+	{
+		return;
+	}
+
+	// A tween with a rate above this passes its end in this update.  One
+	// division for the whole pass rather than one for each tween.
+	fastest = 0xFFFFFFFFUL / elapsed;
+
+	for ( tween = tweens ; tween < end ; ++tween )
+	{
+		uint8_t   flags = tween->flags;
+		uint32_t  phase = tween->phase;
+		uint32_t  next;
+		uint16_t  at;
+		int32_t   span;
+		uint32_t  eased;
+		uint32_t  part;
+
+		if ( flags & Tween_DONE )
+		{
+			continue;
+		}
+
+		next = phase + tween->rate * elapsed;
+
+		if ( tween->rate > fastest || next < phase )
+		{
+			switch ( flags & Tween_MODE )
+			{
+				case TWEEN_ONCE:
+					next   = 0xFFFFFFFFUL;
+					flags |= Tween_DONE;
+					break;
+
+				case TWEEN_PING_PONG:
+					flags ^= Tween_REVERSE;
+
+					if ( ! ( flags & Tween_REVERSE ) )
+					{
+						flags |= Tween_CYCLED;
+					}
+					break;
+
+				default:
+					// A loop carries on from the overshoot.
+					break;
+			}
+		}
+
+		tween->phase = next;
+		tween->flags = flags;
+
+		at = next >> 16;
+
+		if ( flags & Tween_REVERSE )
+		{
+			at = 0xFFFF - at;
+		}
+
+		// The span of two int16_t values needs 17 bits, so its size times
+		// the ease only fits in an unsigned 32 bit product.  A full ease
+		// counts as 0x10000 so the end lands on to exactly.
+		eased = Easing::ease( tween->curve, at );
+		eased = ( eased == 0xFFFF ) ? 0x10000UL : eased;
+		span  = (int32_t) tween->to - tween->from;
+		part  = ( (uint32_t) ( ( span < 0 ) ? -span : span ) * eased + 0x8000UL ) >> 16;
+
+		tween->value = (int16_t) ( tween->from + ( ( span < 0 ) ? -(int32_t) part : (int32_t) part ) );
+	}
+}
+
+uint16_t Animator::progress( const Tween & tween )
+{
+	uint16_t  at = tween.phase >> 16;
+
+	if ( tween.flags & Tween_REVERSE )
+	{
+		at = 0xFFFF - at;
+	}
+
+	return Easing::ease( tween.curve, at );
+}
+
+bool Animator::cycled( Tween & tween )
+{
+	bool  done = ( tween.flags & Tween_CYCLED ) != 0;
+
+	tween.flags &= ~Tween_CYCLED;
+
+	return done;
+}
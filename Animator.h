@@ -0,0 +1,215 @@
+/**
+ * Tweens values such as positions, blend amounts and brightness along
+ * easing curves, many at a time.
+ *
+ *  @date   Created on October 18, 2026
+ *  @author Steven F. LeBrun
+ *  <br/><br/>
+ */
+
+#ifndef ANIMATOR_H_
+#define ANIMATOR_H_
+
+#include <Arduino.h>
+
+#include "Clock.h"
+#include "Easing.h"
+
+/**
+ * The longest time, in milliseconds, one update moves the tweens.  A long
+ * pause, such as a counter report, should not fling them to their ends.
+ */
+#define  Animator_MAX_STEP_MS  1000
+
+/**
+ * What a tween does when it reaches its end.
+ */
+enum TweenMode
+{
+	TWEEN_ONCE       = 0,  ///< Stops at the end.
+	TWEEN_LOOP       = 1,  ///< Starts again from the beginning.
+	TWEEN_PING_PONG  = 2   ///< Runs back to the beginning, then forward again.
+};
+
+/**
+ * The mode bits of Tween::flags.
+ */
+#define  Tween_MODE     0x03
+
+/**
+ * Set in Tween::flags while a ping pong tween runs back.
+ */
+#define  Tween_REVERSE  0x04
+
+/**
+ * Set in Tween::flags when a ping pong tween gets back to the beginning.
+ * Cleared by Animator::cycled().
+ */
+#define  Tween_CYCLED   0x08
+
+/**
+ * Set in Tween::flags when a TWEEN_ONCE tween has reached its end.
+ */
+#define  Tween_DONE     0x10
+
+/**
+ * One tween: a value moving from one number to another over a time, along
+ * an easing curve.  16 bytes, kept in an array and moved by
+ * Animator::update() in one pass.
+ *
+ * Colors and brightness are tweened as blend amounts or levels from 0 to
+ * 255, for example blend( from, to, value ) or LedDevice::setBrightness(
+ * value ).  Positions can be given in fractions of an LED unit.
+ */
+struct Tween
+{
+	uint32_t  phase;   ///< How far through the tween, as a fraction of 2^32.
+	uint32_t  rate;    ///< Added to phase each millisecond.
+	int16_t   from;    ///< The value at the beginning.
+	int16_t   to;      ///< The value at the end.
+	int16_t   value;   ///< The value now, set by Animator::update().
+	uint8_t   curve;   ///< One of the EasingCurve values.
+	uint8_t   flags;   ///< One of the TweenMode values and the Tween_ bits.
+};
+
+/**
+ * Runs an array of tweens against the Clock.  The array is owned by the
+ * caller, like the colors of a BufferDevice, so the sketch chooses how
+ * much RAM to give it.
+ *
+ * Each call to update() moves every tween by the time since the last call
+ * in one pass over the array: a multiply and an add to move the phase,
+ * an easing table lookup, and a multiply to scale the result between the
+ * two ends.  There is no division per tween and no floating point, so
+ * hundreds of tweens can be moved each frame, @see BENCH_TWEENS.
+ *
+ * Light shows that need a single tween, such as Sweeper, can keep a Tween
+ * of their own and use the static methods.
+ */
+class Animator
+{
+	private:
+		/**
+		 * The tweens.
+		 */
+		Tween *        tweens;
+
+		/**
+		 * The number of elements in the tweens array.
+		 */
+		uint16_t       capacity;
+
+		/**
+		 * The number of tweens in use, at the start of the array.
+		 */
+		uint16_t       count;
+
+		/**
+		 * The Clock::millis() value of the last update.
+		 */
+		unsigned long  lastTime;
+
+	public:
+		/**
+		 * Constructor.
+		 *
+		 * @param pool  An array for the tweens, which must remain valid
+		 *              while the Animator is in use.
+		 * @param size  The number of elements in the array.
+		 */
+		Animator( Tween * pool, uint16_t size );
+
+		/**
+		 * Removes every tween.
+		 */
+		void clear() { count = 0; };
+
+		/**
+		 * Adds a tween.  It starts at the next update().
+		 *
+		 * @param from   The value at the beginning.
+		 * @param to     The value at the end.  Any two int16_t values may
+		 *               be used, for example -20000 to 20000.
+		 * @param ms     The time from the beginning to the end.
+		 * @param curve  One of the EasingCurve values.
+		 * @param mode   One of the TweenMode values.
+		 *
+		 * @return Returns the index of the tween, or -1 if the array is full.
+		 */
+		int add( int16_t from, int16_t to, unsigned long ms,
+		         uint8_t curve = EASE_LINEAR, uint8_t mode = TWEEN_ONCE );
+
+		/**
+		 * Restarts the clock, so the time until now is not counted.  Call
+		 * when the tweens start or resume after a pause.
+		 */
+		void restart() { lastTime = Clock::millis(); };
+
+		/**
+		 * Moves every tween by the time since the last update.
+		 */
+		void update();
+
+		/**
+		 * @return Returns the number of tweens.
+		 */
+		uint16_t getCount() { return count; };
+
+		/**
+		 * @param i  The index returned by add().
+		 * @return Returns the tween.
+		 */
+		Tween & get( int i ) { return tweens[i]; };
+
+		/**
+		 * @param i  The index returned by add().
+		 * @return Returns the value of the tween as of the last update.
+		 */
+		int16_t value( int i ) { return tweens[i].value; };
+
+		/**
+		 * Sets up a tween at its beginning.
+		 *
+		 * @param tween  The tween.
+		 * @param from   The value at the beginning.
+		 * @param to     The value at the end.
+		 * @param ms     The time from the beginning to the end.
+		 * @param curve  One of the EasingCurve values.
+		 * @param mode   One of the TweenMode values.
+		 */
+		static void set( Tween & tween, int16_t from, int16_t to, unsigned long ms,
+		                 uint8_t curve = EASE_LINEAR, uint8_t mode = TWEEN_ONCE );
+
+		/**
+		 * Moves an array of tweens by the same time.  The pass that does
+		 * the work of update().
+		 *
+		 * @param tweens   The tweens.
+		 * @param n        The number of tweens.
+		 * @param elapsed  The time to move them by, in milliseconds.
+		 */
+		static void update( Tween * tweens, uint16_t n, uint16_t elapsed );
+
+		/**
+		 * @return Returns how far a tween has moved along its curve, from 0
+		 *         at the beginning to 65535 at the end.  For a value with
+		 *         more than 16 bits of range, such as a position on a long
+		 *         LED Device in fractions of an LED unit.
+		 */
+		static uint16_t progress( const Tween & tween );
+
+		/**
+		 * Reports whether a ping pong tween has got back to its beginning
+		 * since the last call.
+		 *
+		 * @return Returns @b true once for each cycle.
+		 */
+		static bool cycled( Tween & tween );
+
+		/**
+		 * @return Returns @b true once a TWEEN_ONCE tween has reached its end.
+		 */
+		static bool isDone( const Tween & tween ) { return ( tween.flags & Tween_DONE ) != 0; };
+};
+
+#endif /* ANIMATOR_H_ */
@@ -0,0 +1,129 @@
+/*
+ * AudioInput.cpp
+ *
+ *  Created on: Oct 18, 2026
+ *      Author: Steven F. LeBrun
+ */
+
+#include "AudioInput.h"
+
+int16_t            AudioInput::dc        = 0;
+int16_t            AudioInput::lowBass   = 0;
+int16_t            AudioInput::lowMid    = 0;
+volatile uint32_t  AudioInput::sumBass   = 0;
+volatile uint32_t  AudioInput::sumMid    = 0;
+volatile uint32_t  AudioInput::sumTreble = 0;
+volatile uint16_t  AudioInput::count     = 0;
+
+#if defined(__AVR__)
+
+ISR(ADC_vect)
+{
+	AudioInput::addSample( ADCH );
+}
+
+#endif
+
+void AudioInput::begin( uint8_t pin )
+{
+	uint8_t  oldSREG = SREG;
+	noInterrupts();
+
+	dc        = 0;
+	lowBass   = 0;
+	lowMid    = 0;
+	sumBass   = 0;
+	sumMid    = 0;
+	sumTreble = 0;
+	count     = 0;
+
+	SREG = oldSREG;
+
+#if defined(__AVR__)
+	uint8_t  channel = ( pin >= A0 ) ? pin - A0 : pin;
+
+	// AVcc reference, result left adjusted so ADCH holds the top 8 bits.
+	ADMUX  = _BV(REFS0) | _BV(ADLAR) | ( channel & 0x07 );
+	ADCSRB = 0;
+	DIDR0 |= _BV( channel & 0x07 );
+
+	// Enabled, started, free running, interrupt on, prescaler 128.
+	ADCSRA = _BV(ADEN) | _BV(ADSC) | _BV(ADATE) | _BV(ADIE)
+	       | _BV(ADPS2) | _BV(ADPS1) | _BV(ADPS0);
+#else
+	(void) pin;
+#endif
+}
+
+void AudioInput::end()
+{
+#if defined(__AVR__)
+	// Enabled with the prescaler analogRead() expects, nothing else.
+	ADCSRA = _BV(ADEN) | _BV(ADPS2) | _BV(ADPS1) | _BV(ADPS0);
+#endif
+}
+
+void AudioInput::addSample( uint8_t sample )
+{
+	int16_t  x = ( (int16_t) sample - 128 ) * 32;
+
+	dc += ( x - dc ) >> AudioInput_DC_SHIFT;
+	x  -= dc;
+
+	lowBass += ( x - lowBass ) >> AudioInput_BASS_SHIFT;
+	lowMid  += ( x - lowMid ) >> AudioInput_MID_SHIFT;
+
+	int16_t  bass   = lowBass;
+	int16_t  mid    = lowMid - lowBass;
+	int16_t  treble = x - lowMid;
+
+	sumBass   += ( bass < 0 ) ? -bass : bass;
+	sumMid    += ( mid < 0 ) ? -mid : mid;
+	sumTreble += ( treble < 0 ) ? -treble : treble;
+	++count;
+}
+
+/**
+ * Turns a total into a level: the average in 1/32nds of an ADC count,
+ * times two, capped at 255.
+ */
+static uint8_t level( uint32_t sum, uint16_t n )
+{
+	uint32_t  average = ( sum / n ) >> 4;
+
+	return ( average > 255 ) ? 255 : (uint8_t) average;
+}
+
+bool AudioInput::take( AudioBands & bands )
+{
+	uint8_t  oldSREG = SREG;
+	noInterrupts();
+
+	uint32_t  b = sumBass;
+	uint32_t  m = sumMid;
+	uint32_t  t = sumTreble;
+	uint16_t  n = count;
+
+	sumBass   = 0;
+	sumMid    = 0;
+	sumTreble = 0;
+	count     = 0;
+
+	SREG = oldSREG;
+
+	bands.samples = n;
+
+	if ( n == 0 )
+	{
+		bands.bass   = 0;
+		bands.mid    = 0;
+		bands.treble = 0;
+		return false;
+	}
+
+	bands.bass   = level( b, n );
+	bands.mid    = level( m, n );
+	bands.treble = level( t, n );
+
+	return true;
+}
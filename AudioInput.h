@@ -0,0 +1,126 @@
+/**
+ * Samples an analog pin in the background and splits the signal into
+ * bands of frequencies.
+ *
+ *  @date   Created on October 18, 2026
+ *  @author Steven F. LeBrun
+ *  <br/><br/>
+ */
+
+#ifndef AUDIOINPUT_H_
+#define AUDIOINPUT_H_
+
+#include <Arduino.h>
+
+/**
+ * The number of samples per second.  The ADC runs free with a prescaler of
+ * 128 and takes 13 ADC clocks per sample: 16 MHz / 128 / 13.
+ */
+#define  AudioInput_SAMPLE_RATE   9615
+
+/**
+ * The shift of the one pole low pass filter that separates the bass band,
+ * about 190 Hz at the sample rate.
+ */
+#define  AudioInput_BASS_SHIFT    3
+
+/**
+ * The shift of the one pole low pass filter that separates the middle band
+ * from the treble band, about 1.5 kHz at the sample rate.
+ */
+#define  AudioInput_MID_SHIFT     1
+
+/**
+ * The shift of the very slow low pass filter that tracks the bias of the
+ * microphone, so it is removed before the bands are split.
+ */
+#define  AudioInput_DC_SHIFT      8
+
+/**
+ * The average level of each band since the bands were last taken.  A
+ * level is the average size of the signal in the band, in ADC counts
+ * times two, so a full scale signal is about 255.
+ */
+struct AudioBands
+{
+	uint8_t   bass;
+	uint8_t   mid;
+	uint8_t   treble;
+
+	/**
+	 * The number of samples the levels were averaged over.
+	 */
+	uint16_t  samples;
+};
+
+/**
+ * The AudioInput class runs the ADC of an AVR in free running mode on one
+ * analog pin and splits each sample into bass, middle and treble bands
+ * with two one pole low pass filters, as the ADC interrupt arrives.  Only
+ * shifts and additions are used, so a sample costs a few microseconds and
+ * no buffer of samples is needed: the interrupt adds the size of each band
+ * to a running total, and take() turns the totals into average levels once
+ * a frame.
+ *
+ * Like EventLog, all members are static since there is only one ADC.
+ * While sampling, analogRead() must not be used.  On other boards begin()
+ * does nothing and the samples are passed to addSample() by the caller,
+ * as the host side audio replay does, @see extras/AudioReplay.cpp.
+ */
+class AudioInput
+{
+	private:
+		/**
+		 * The bias of the signal, in 1/32nds of an ADC count.
+		 */
+		static int16_t            dc;
+
+		/**
+		 * The outputs of the two low pass filters, in 1/32nds of an ADC count.
+		 */
+		static int16_t            lowBass;
+		static int16_t            lowMid;
+
+		/**
+		 * The running totals of the size of each band.
+		 */
+		static volatile uint32_t  sumBass;
+		static volatile uint32_t  sumMid;
+		static volatile uint32_t  sumTreble;
+
+		/**
+		 * The number of samples in the totals.
+		 */
+		static volatile uint16_t  count;
+
+	public:
+		/**
+		 * Starts sampling an analog pin.
+		 *
+		 * @param pin  The analog pin, such as A1.
+		 */
+		static void begin( uint8_t pin );
+
+		/**
+		 * Stops sampling and gives the ADC back to analogRead().
+		 */
+		static void end();
+
+		/**
+		 * Filters one sample and adds it to the totals.  Called by the ADC
+		 * interrupt.
+		 *
+		 * @param sample  The top 8 bits of the ADC, 128 for silence.
+		 */
+		static void addSample( uint8_t sample );
+
+		/**
+		 * Averages the totals into levels and starts new totals.
+		 *
+		 * @param bands  Set to the levels since the last call.
+		 * @return Returns @b false if there were no samples.
+		 */
+		static bool take( AudioBands & bands );
+};
+
+#endif /* AUDIOINPUT_H_ */
@@ -0,0 +1,100 @@
+/*
+ * AudioShow.cpp
+ *
+ *  Created on: Oct 18, 2026
+ *      Author: Steven F. LeBrun
+ */
+
+#include <string.h>
+
+#include "AudioShow.h"
+#include "Colors.h"
+
+AudioShow::AudioShow( LedDevice * dLEDs, uint8_t pin, const uint8_t * palette ) :
+	MultiDeviceShow(dLEDs, AudioShow_DELAY), pin(pin), palette(palette),
+	bassAverage(0), level(0), position(0), sinceBeat(0), beats(0)
+{
+	memset( &bands, 0, sizeof(bands) );
+}
+
+AudioShow::~AudioShow()
+{
+}
+
+void AudioShow::start()
+{
+	bassAverage = 0;
+	level       = 0;
+	position    = 0;
+	sinceBeat   = AudioShow_MIN_FRAMES;
+	beats       = 0;
+
+	AudioInput::begin( pin );
+}
+
+void AudioShow::suspend()
+{
+	AudioInput::end();
+}
+
+void AudioShow::resume()
+{
+	AudioInput::begin( pin );
+	AudioInput::take( bands );
+}
+
+bool AudioShow::nextFrame()
+{
+	uint8_t  d;
+	int      i;
+
+	AudioInput::take( bands );
+
+	if ( sinceBeat < 255 )
+	{
+		++sinceBeat;
+	}
+
+	// A beat is bass half as loud again as its recent average.
+	uint16_t  bass16 = (uint16_t) bands.bass << 4;
+
+	if ( bands.bass >= AudioShow_MIN_BASS && sinceBeat >= AudioShow_MIN_FRAMES
+	     && 2UL * bass16 > 3UL * bassAverage )
+	{
+		level     = 255;
+		sinceBeat = 0;
+		position += AudioShow_BEAT_STEP << 8;
+		++beats;
+	}
+	else
+	{
+		level = scale8( level, AudioShow_DECAY );
+	}
+
+	// The average follows the bass over about 16 frames.
+	bassAverage += ( (int16_t) bass16 - (int16_t) bassAverage ) >> 4;
+
+	position += bands.treble;
+
+	uint8_t  brightness = qadd8( level, bands.mid );
+
+	for ( d = 0 ; d < nDevices ; ++d )
+	{
+		LedDevice *  dLEDs   = devices[d];
+		CRGB *       leds    = dLEDs->getLEDs();
+		int          maxLEDs = dLEDs->numberOfLEDs();
+
+		// Each device shows half the palette from the current position.
+		for ( i = 0 ; i < maxLEDs ; ++i )
+		{
+			uint8_t  p = ( position >> 8 ) + (uint8_t) ( ( (long) i * 128 ) / maxLEDs );
+
+			leds[i] = Colors::paletteColor( palette, p );
+			leds[i].nscale8_video( brightness );
+		}
+
+		dLEDs->setChanged();
+	}
+
+	return true;
+}
@@ -0,0 +1,153 @@
+/**
+ * Light Show that follows the beat of music picked up on an analog pin.
+ *
+ *  @date   Created on October 18, 2026
+ *  @author Steven F. LeBrun
+ *  <br/><br/>
+ */
+
+#ifndef AUDIOSHOW_H_
+#define AUDIOSHOW_H_
+
+#include "AudioInput.h"
+#include "LedDevice.h"
+#include "MultiDeviceShow.h"
+
+/**
+ * The time, in milliseconds, between frames.
+ */
+#define  AudioShow_DELAY        20
+
+/**
+ * The brightness left after each frame following a beat, out of 256.
+ */
+#define  AudioShow_DECAY       220
+
+/**
+ * The quietest bass level that can be a beat.
+ */
+#define  AudioShow_MIN_BASS     12
+
+/**
+ * The fewest frames between two beats.
+ */
+#define  AudioShow_MIN_FRAMES    8
+
+/**
+ * The palette positions moved on each beat.
+ */
+#define  AudioShow_BEAT_STEP    24
+
+/**
+ * Light Show derived class that flashes one or more LED Devices on the beat
+ * of the music sampled by AudioInput.
+ *
+ * Each frame takes the band levels since the last frame.  A beat is a bass
+ * level half as loud again as its recent average.  A beat sets the
+ * brightness to full and moves the colors along a gradient palette, and
+ * the brightness then decays until the next beat; the middle band keeps a
+ * glow between beats and the treble band drifts the colors.  The analysis
+ * done per frame is a few divisions, the rest is done per sample by the ADC
+ * interrupt, so it fits in the frame time alongside show().
+ *
+ * Sampling runs only while the show does, and stops when it is suspended.
+ */
+class AudioShow: public MultiDeviceShow
+{
+	private:
+		/**
+		 * The analog pin sampled.
+		 */
+		uint8_t         pin;
+
+		/**
+		 * The palette in flash that colors are looked up in.
+		 */
+		const uint8_t * palette;
+
+		/**
+		 * The levels of the last frame.
+		 */
+		AudioBands      bands;
+
+		/**
+		 * The recent average of the bass level, in 1/16ths.
+		 */
+		uint16_t        bassAverage;
+
+		/**
+		 * The brightness left from the last beat.
+		 */
+		uint8_t         level;
+
+		/**
+		 * The palette position of the first LED unit, in 1/256ths.
+		 */
+		uint16_t        position;
+
+		/**
+		 * Frames since the last beat.
+		 */
+		uint8_t         sinceBeat;
+
+		/**
+		 * The number of beats found since the show started.
+		 */
+		uint16_t        beats;
+
+	public:
+		/**
+		 * Constructor.
+		 *
+		 * @param dLEDs    Pointer to the first LED Device to be used.
+		 * @param pin      The analog pin the audio is on, such as A1.
+		 * @param palette  A palette in flash, such as Colors::PARTY_PALETTE.
+		 */
+		AudioShow( LedDevice * dLEDs, uint8_t pin, const uint8_t * palette );
+
+		/**
+		 * Destructor.  The devices are owned by the creator of this object.
+		 */
+		virtual ~AudioShow();
+
+		/**
+		 * Starts sampling with no beat history.
+		 */
+		virtual void start();
+
+		/**
+		 * Stops sampling.
+		 */
+		virtual void suspend();
+
+		/**
+		 * Starts sampling again.  The levels taken while suspended are
+		 * thrown away by the first frame.
+		 */
+		virtual void resume();
+
+		/**
+		 * Takes the band levels, looks for a beat and sets every LED unit
+		 * of every device.
+		 *
+		 * @return Always returns @b true.
+		 */
+		virtual bool nextFrame();
+
+		/**
+		 * @return Returns SHOW_AUDIO.
+		 */
+		virtual uint8_t getShowType() { return SHOW_AUDIO; };
+
+		/**
+		 * @return Returns the band levels of the last frame.
+		 */
+		const AudioBands & getBands() { return bands; };
+
+		/**
+		 * @return Returns the number of beats found since the show started.
+		 */
+		uint16_t getBeats() { return beats; };
+};
+
+#endif /* AUDIOSHOW_H_ */
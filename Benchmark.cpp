@@ -0,0 +1,648 @@
+/*
+ * Benchmark.cpp
+ *
+ *  Created on: Oct 18, 2026
+ *      Author: Steven F. LeBrun
+ */
+
+#include <stdlib.h>
+#include <string.h>
+
+#include "Benchmark.h"
+#include "Colors.h"
+#include "EventLog.h"
+#include "FillSolid.h"
+#include "FillSolidShader.h"
+#include "ParticleSparkle.h"
+#include "ProgramShow.h"
+#include "RgbwConverter.h"
+#include "SparkleLEDs.h"
+#include "StaticFillSolid.h"
+#include "Sweeper.h"
+#include "SweeperShader.h"
+
+const int  Benchmark::SIZES[]   = { 12, 60, 300, 1000, 10000 };
+const int  Benchmark::MAX_SIZES = sizeof(SIZES) / sizeof(int);
+
+const int  Benchmark::TWEEN_COUNTS[]   = { 8, 64, 256 };
+const int  Benchmark::MAX_TWEEN_COUNTS = sizeof(TWEEN_COUNTS) / sizeof(int);
+
+/**
+ * Results are folded into this variable so the compiler cannot remove
+ * operations whose result is otherwise unused.
+ */
+static volatile uint8_t  sink;
+
+/**
+ * A second color array and a calibration table for the current size, used
+ * by the commit benchmarks.  NULL if there was not enough memory for them.
+ */
+static CRGB *     spare;
+static uint8_t *  table;
+
+/**
+ * The batch corrections used by the calibrated commit benchmark.
+ */
+static const CRGB  benchBatches[] = { CRGB( 255, 255, 255 ), CRGB( 255, 200, 180 ) };
+
+/**
+ * @return Returns @b true for the benchmarks that run on a device rather
+ *         than on an XYMap or on tweens.
+ */
+static bool isDeviceBench( uint8_t bench )
+{
+	return ( bench != BENCH_XY_TABLE && bench != BENCH_XY_COMPUTED && bench != BENCH_TWEENS );
+}
+
+#if Benchmark_CYCLES && defined(__AVR__)
+
+/**
+ * The number of times Timer1 has overflowed since the cycle counter was
+ * started.  Together with TCNT1 this forms a 32 bit cycle counter.
+ */
+static volatile uint16_t  overflows;
+
+ISR(TIMER1_OVF_vect)
+{
+	++overflows;
+}
+
+/**
+ * Reads the 32 bit cycle counter.
+ */
+static unsigned long benchClock()
+{
+	uint8_t   oldSREG = SREG;
+	noInterrupts();
+
+	uint16_t  low  = TCNT1;
+	uint16_t  high = overflows;
+
+	// An overflow that happened after interrupts were turned off has not
+	// been counted yet.
+	if ( ( TIFR1 & _BV(TOV1) ) && ( low < 0x8000 ) )
+	{
+		++high;
+	}
+
+	SREG = oldSREG;
+
+	return ( (unsigned long) high << 16 ) | low;
+}
+
+#else
+
+/**
+ * Reads the microsecond clock.  Benchmarks time the processor, so they read
+ * the Arduino timer directly rather than the installed Clock.
+ */
+static unsigned long benchClock()
+{
+	return micros();
+}
+
+#endif
+
+unsigned long Benchmark::time( uint8_t bench, BufferDevice * dLEDs, unsigned long iterations )
+{
+	int            maxLEDs = dLEDs->numberOfLEDs();
+	CRGB *         leds    = dLEDs->getLEDs();
+	unsigned long  n;
+	unsigned long  start   = 0;
+	int            i;
+
+	// Each case builds only what it needs, inside its own block, so the
+	// stack holds one light show at a time next to the heap buffers.
+	switch ( bench )
+	{
+		case BENCH_SET_LEDS:
+			start = benchClock();
+			for ( n = 0 ; n < iterations ; ++n )
+			{
+				dLEDs->setLEDs( CRGB::Red );
+			}
+			break;
+
+		case BENCH_ADVANCE:
+			start = benchClock();
+			for ( n = 0 ; n < iterations ; ++n )
+			{
+				dLEDs->advanceLEDs();
+			}
+			break;
+
+		case BENCH_RETREAT:
+			start = benchClock();
+			for ( n = 0 ; n < iterations ; ++n )
+			{
+				dLEDs->retreatLEDs();
+			}
+			break;
+
+		case BENCH_SET_LED_LOOP:
+			start = benchClock();
+			for ( n = 0 ; n < iterations ; ++n )
+			{
+				for ( i = 0 ; i < maxLEDs ; ++i )
+				{
+					dLEDs->setLED( i, CRGB::Blue );
+				}
+			}
+			break;
+
+		case BENCH_SWEEPER:
+		{
+			Sweeper  sweep( dLEDs );
+
+			sweep.setNumLEDs( maxLEDs / 6 );
+			sweep.setCycles( 0 );
+			sweep.start();
+			sweep.nextFrame();     // The first frame only initializes the LED units.
+
+			start = benchClock();
+			for ( n = 0 ; n < iterations ; ++n )
+			{
+				sweep.nextFrame();
+			}
+			break;
+		}
+
+		case BENCH_PROGRAM_SWEEP:
+		{
+			ProgramShow  program( dLEDs, ProgramShow::SWEEPER_PROGRAM );
+
+			program.setRegister( 1, maxLEDs / 6 );
+			program.start();
+			program.nextFrame();
+
+			start = benchClock();
+			for ( n = 0 ; n < iterations ; ++n )
+			{
+				program.nextFrame();
+			}
+			break;
+		}
+
+		case BENCH_FILL_SOLID:
+		{
+			FillSolid  solid( CRGB::White, CRGB::Black, dLEDs );
+
+			solid.start();
+
+			start = benchClock();
+			for ( n = 0 ; n < iterations ; ++n )
+			{
+				if ( ! solid.nextFrame() )
+				{
+					solid.start();
+				}
+			}
+			break;
+		}
+
+		case BENCH_SPARKLE:
+		{
+			SparkleLEDs  sparkle( dLEDs );
+
+			start = benchClock();
+			for ( n = 0 ; n < iterations ; ++n )
+			{
+				sparkle.nextFrame();
+			}
+			break;
+		}
+
+		case BENCH_NEXT_COLOR:
+		{
+			Colors  colors;
+
+			start = benchClock();
+			for ( n = 0 ; n < iterations ; ++n )
+			{
+				sink ^= colors.nextColor().r;
+			}
+			break;
+		}
+
+		case BENCH_RANDOM_COLOR:
+			start = benchClock();
+			for ( n = 0 ; n < iterations ; ++n )
+			{
+				sink ^= Colors::randomJustColor().g;
+			}
+			break;
+
+		case BENCH_FILL_STATIC:
+		case BENCH_FILL_WRAPPED:
+		{
+			StaticFillSolid  staticSolid( CRGB::White, CRGB::Black, dLEDs );
+
+			// Stops the compiler from seeing through the virtual call.
+			LightShow * volatile  wrapped = &staticSolid;
+
+			staticSolid.start();
+
+			start = benchClock();
+			if ( bench == BENCH_FILL_STATIC )
+			{
+				staticSolid.frames( iterations );
+			}
+			else
+			{
+				for ( n = 0 ; n < iterations ; ++n )
+				{
+					if ( ! wrapped->nextFrame() )
+					{
+						wrapped->start();
+					}
+				}
+			}
+			break;
+		}
+
+		case BENCH_COMMIT:
+		case BENCH_COMMIT_CALIBRATED:
+		case BENCH_COMMIT_DIMMED:
+		{
+			// A device of its own, so swapping buffers does not disturb the
+			// device used by the other benchmarks.
+			BufferDevice  buffered( maxLEDs, leds );
+
+			buffered.setBackBuffer( spare, false );
+
+			if ( bench == BENCH_COMMIT_CALIBRATED )
+			{
+				buffered.setCalibration( table, benchBatches );
+			}
+
+			if ( bench == BENCH_COMMIT_DIMMED )
+			{
+				buffered.setBrightness( 128 );
+			}
+
+			start = benchClock();
+			for ( n = 0 ; n < iterations ; ++n )
+			{
+				buffered.commit();
+			}
+			break;
+		}
+
+		case BENCH_SHADER_SWEEP:
+		case BENCH_SHADER_FILL:
+		{
+			SweeperShader    sweepShader( dLEDs );
+			FillSolidShader  fillShader( CRGB::White, CRGB::Black, dLEDs );
+
+			sweepShader.setNumLEDs( maxLEDs / 6 );
+			sweepShader.setCycles( 0 );
+			sweepShader.start();
+			fillShader.start();
+
+			// Calls shade() the way ShaderDevice::show() does, through a
+			// pointer to the base class.
+			PixelShader * volatile  shader = ( bench == BENCH_SHADER_FILL )
+			                                 ? (PixelShader *) &fillShader : (PixelShader *) &sweepShader;
+
+			start = benchClock();
+			for ( n = 0 ; n < iterations ; ++n )
+			{
+				PixelShader *  s = shader;
+
+				if ( ! s->prepare() )
+				{
+					s->start();
+				}
+
+				for ( i = 0 ; i < maxLEDs ; ++i )
+				{
+					sink ^= s->shade( i ).r;
+				}
+			}
+			break;
+		}
+
+		case BENCH_RGBW_MIN:
+		case BENCH_RGBW_CALIBRATED:
+		{
+			RgbwConverter  rgbw;
+			RgbwPixel      pixel;
+
+			// Pastel colors, so that every LED unit has some white in it.
+			for ( i = 0 ; i < maxLEDs ; ++i )
+			{
+				leds[i] = Colors::hsvColor( (uint8_t) ( i * 7 ), 160, 220 );
+			}
+
+			if ( bench == BENCH_RGBW_CALIBRATED )
+			{
+				rgbw.setWhite( CRGB( 255, 200, 140 ) );
+			}
+
+			start = benchClock();
+			for ( n = 0 ; n < iterations ; ++n )
+			{
+				for ( i = 0 ; i < maxLEDs ; ++i )
+				{
+					rgbw.convert( leds[i], pixel );
+					sink ^= pixel.r ^ pixel.g ^ pixel.b ^ pixel.w;
+				}
+			}
+			break;
+		}
+
+		case BENCH_PARTICLES:
+		{
+			ParticleSparkle  particles( dLEDs );
+
+			particles.start();
+
+			// Run long enough for the number of lit particles to settle.
+			for ( n = 0 ; n < 64 ; ++n )
+			{
+				particles.nextFrame();
+			}
+
+			start = benchClock();
+			for ( n = 0 ; n < iterations ; ++n )
+			{
+				particles.nextFrame();
+			}
+			break;
+		}
+
+		case BENCH_PALETTE_FILL:
+			start = benchClock();
+			for ( n = 0 ; n < iterations ; ++n )
+			{
+				Colors::fillPalette( leds, maxLEDs, Colors::RAINBOW_PALETTE, (uint8_t) n, 3 );
+			}
+			break;
+
+		// The HSV conversions use the same hues and a saturation and value
+		// below 255 so that every path scales the channels.
+		case BENCH_HSV_LUT:
+			start = benchClock();
+			for ( n = 0 ; n < iterations ; ++n )
+			{
+				for ( i = 0 ; i < maxLEDs ; ++i )
+				{
+					leds[i] = Colors::hsvColor( (uint8_t) ( n + i ), 240, 200 );
+				}
+			}
+			break;
+
+		case BENCH_HSV_RAINBOW:
+			start = benchClock();
+			for ( n = 0 ; n < iterations ; ++n )
+			{
+				for ( i = 0 ; i < maxLEDs ; ++i )
+				{
+					hsv2rgb_rainbow( CHSV( (uint8_t) ( n + i ), 240, 200 ), leds[i] );
+				}
+			}
+			break;
+
+		case BENCH_HSV_SPECTRUM:
+			start = benchClock();
+			for ( n = 0 ; n < iterations ; ++n )
+			{
+				for ( i = 0 ; i < maxLEDs ; ++i )
+				{
+					hsv2rgb_spectrum( CHSV( (uint8_t) ( n + i ), 240, 200 ), leds[i] );
+				}
+			}
+			break;
+
+		default:
+			start = benchClock();
+			break;
+	}
+
+	return benchClock() - start;
+}
+
+unsigned long Benchmark::timeMap( uint8_t bench, XYMap * map, unsigned long iterations )
+{
+	uint8_t        width  = map->getWidth();
+	uint8_t        height = map->getHeight();
+	uint16_t       sum    = 0;
+	unsigned long  n;
+	unsigned long  start;
+	uint8_t        x;
+	uint8_t        y;
+
+	start = benchClock();
+
+	switch ( bench )
+	{
+		case BENCH_XY_TABLE:
+			for ( n = 0 ; n < iterations ; ++n )
+			{
+				for ( y = 0 ; y < height ; ++y )
+				{
+					for ( x = 0 ; x < width ; ++x )
+					{
+						sum += map->index( x, y );
+					}
+				}
+			}
+			break;
+
+		case BENCH_XY_COMPUTED:
+			for ( n = 0 ; n < iterations ; ++n )
+			{
+				for ( y = 0 ; y < height ; ++y )
+				{
+					for ( x = 0 ; x < width ; ++x )
+					{
+						sum += map->compute( x, y );
+					}
+				}
+			}
+			break;
+	}
+
+	unsigned long  elapsed = benchClock() - start;
+
+	sink ^= (uint8_t) sum;
+
+	return elapsed;
+}
+
+unsigned long Benchmark::timeTweens( Tween * tweens, uint16_t nTweens, unsigned long iterations )
+{
+	unsigned long  n;
+	unsigned long  start = benchClock();
+
+	for ( n = 0 ; n < iterations ; ++n )
+	{
+		Animator::update( tweens, nTweens, 10 );
+	}
+
+	unsigned long  elapsed = benchClock() - start;
+
+	sink ^= (uint8_t) tweens[nTweens - 1].value;
+
+	return elapsed;
+}
+
+void Benchmark::measure( uint8_t bench, BufferDevice * dLEDs, XYMap * map, Tween * tweens, uint16_t nTweens )
+{
+	uint16_t  nLEDs = ( map != NULL ) ? map->size() : ( tweens != NULL ) ? nTweens : dLEDs->numberOfLEDs();
+
+	if ( ( bench == BENCH_COMMIT || bench == BENCH_COMMIT_CALIBRATED || bench == BENCH_COMMIT_DIMMED ) && table == NULL )
+	{
+		// Not enough memory for the second buffer, report as not run.
+		EventLog::log( LOG_BENCH, bench, nLEDs );
+		EventLog::flush();
+		return;
+	}
+
+	unsigned long  iterations = 1;
+	unsigned long  elapsed;
+	unsigned long  limit = Benchmark_MIN_TIME;
+
+#if Benchmark_CYCLES && defined(__AVR__)
+	limit *= clockCyclesPerMicrosecond();
+#endif
+
+	for ( ; ; )
+	{
+		elapsed = ( map != NULL )    ? timeMap( bench, map, iterations )
+		        : ( tweens != NULL ) ? timeTweens( tweens, nTweens, iterations )
+		                             : time( bench, dLEDs, iterations );
+
+		if ( ( elapsed >= limit ) || ( iterations >= 0x100000UL ) )
+		{
+			break;
+		}
+
+		iterations *= 2;
+	}
+
+#if Benchmark_CYCLES && defined(__AVR__)
+	uint8_t        event  = LOG_BENCH_CYCLES;
+	unsigned long  perOp  = elapsed / iterations;
+#else
+	uint8_t        event  = LOG_BENCH;
+	unsigned long  perOp  = ( elapsed / iterations ) * 1000UL
+	                      + ( ( elapsed % iterations ) * 1000UL ) / iterations;
+#endif
+
+	uint16_t  args[] = { bench, nLEDs,
+	                     (uint16_t) iterations, (uint16_t) ( iterations >> 16 ),
+	                     (uint16_t) perOp,      (uint16_t) ( perOp >> 16 ) };
+
+	EventLog::write( event, 6, args );
+	EventLog::flush();
+}
+
+void Benchmark::run()
+{
+	int      s;
+	uint8_t  bench;
+
+#if Benchmark_CYCLES && defined(__AVR__)
+	uint8_t  oldA    = TCCR1A;
+	uint8_t  oldB    = TCCR1B;
+	uint8_t  oldMask = TIMSK1;
+
+	// Normal mode, no prescaler: TCNT1 counts CPU cycles.
+	TCCR1A    = 0;
+	TCCR1B    = 0;
+	TCNT1     = 0;
+	overflows = 0;
+	TIFR1     = _BV(TOV1);
+	TIMSK1    = _BV(TOIE1);
+	TCCR1B    = _BV(CS10);
+#endif
+
+	for ( s = 0 ; s < MAX_SIZES ; ++s )
+	{
+		CRGB * lights = (CRGB *) malloc( SIZES[s] * sizeof(CRGB) );
+
+		if ( lights == NULL )
+		{
+			// Not enough memory on this board, report the size as not run.
+			for ( bench = 0 ; bench < BENCH_CASES ; ++bench )
+			{
+				if ( isDeviceBench( bench ) )
+				{
+					EventLog::log( LOG_BENCH, bench, SIZES[s] );
+				}
+			}
+			EventLog::flush();
+			continue;
+		}
+
+		BufferDevice  buffer( SIZES[s], lights );
+
+		spare = (CRGB *) malloc( SIZES[s] * sizeof(CRGB) );
+		table = ( spare == NULL ) ? NULL : (uint8_t *) malloc( ( SIZES[s] + 1 ) / 2 );
+
+		if ( table != NULL )
+		{
+			// Every other LED unit from the second batch.
+			memset( table, 0x10, ( SIZES[s] + 1 ) / 2 );
+		}
+
+		buffer.setBackground( CRGB::Black );
+		buffer.setForeground( CRGB::Yellow );
+		buffer.setLEDsBackground();
+
+		for ( bench = 0 ; bench < BENCH_CASES ; ++bench )
+		{
+			if ( isDeviceBench( bench ) )
+			{
+				measure( bench, &buffer );
+			}
+		}
+
+		free( table );
+		free( spare );
+		free( lights );
+		table = NULL;
+		spare = NULL;
+	}
+
+	// The matrix benchmarks only read the tables, so they need no colors.
+	XYMap  small( 16, 16, XY_SERPENTINE, XY_ROTATE_0, XYMap::SERPENTINE_16x16 );
+	XYMap  large( 32, 32, XY_SERPENTINE, XY_ROTATE_0, XYMap::SERPENTINE_32x32 );
+
+	measure( BENCH_XY_TABLE,    NULL, &small );
+	measure( BENCH_XY_COMPUTED, NULL, &small );
+	measure( BENCH_XY_TABLE,    NULL, &large );
+	measure( BENCH_XY_COMPUTED, NULL, &large );
+
+	// Every curve, half looping and half ping pong, so none of them stop.
+	for ( s = 0 ; s < MAX_TWEEN_COUNTS ; ++s )
+	{
+		Tween *  tweens = (Tween *) malloc( TWEEN_COUNTS[s] * sizeof(Tween) );
+		int      t;
+
+		if ( tweens == NULL )
+		{
+			EventLog::log( LOG_BENCH, BENCH_TWEENS, TWEEN_COUNTS[s] );
+			EventLog::flush();
+			continue;
+		}
+
+		for ( t = 0 ; t < TWEEN_COUNTS[s] ; ++t )
+		{
+			Animator::set( tweens[t], 0, 1000 + t, 500 + 37 * t, t % EASE_CURVES,
+			               ( t & 1 ) ? TWEEN_PING_PONG : TWEEN_LOOP );
+		}
+
+		measure( BENCH_TWEENS, NULL, NULL, tweens, TWEEN_COUNTS[s] );
+
+		free( tweens );
+	}
+
+#if Benchmark_CYCLES && defined(__AVR__)
+	TCCR1B = 0;
+	TIMSK1 = oldMask;
+	TCCR1A = oldA;
+	TCCR1B = oldB;
+#endif
+}
@@ -0,0 +1,139 @@
+/**
+ * Microbenchmarks for the LED Device primitives and for one frame of each
+ * light show.
+ *
+ *  @date   Created on October 18, 2026
+ *  @author Steven F. LeBrun
+ *  <br/><br/>
+ */
+
+#ifndef BENCHMARK_H_
+#define BENCHMARK_H_
+
+#include <Arduino.h>
+
+#include "Animator.h"
+#include "BufferDevice.h"
+#include "EventLogFormat.h"
+#include "XYMap.h"
+
+/**
+ * When set to 1 on an AVR, the benchmarks are timed in CPU cycles using
+ * Timer1 instead of in microseconds using micros().  Cycle counts are
+ * exact and do not depend on the timer0 interrupt, which also makes the
+ * results match when the sketch is run in an AVR simulator such as simavr.
+ *
+ * Timer1 is taken over while the benchmarks run and restored afterwards.
+ * Leave this at 0 if another library uses the Timer1 overflow interrupt.
+ */
+#ifndef  Benchmark_CYCLES
+#define  Benchmark_CYCLES  0
+#endif
+
+/**
+ * The shortest time, in microseconds, a benchmark is run for.  The number
+ * of iterations is doubled until a run takes at least this long.
+ */
+#define  Benchmark_MIN_TIME   50000UL
+
+/**
+ * The Benchmark class runs each BenchCase on a BufferDevice at 12, 60, 300,
+ * 1000 and 10,000 LEDs, except the XYMap cases which are run on 16 x 16
+ * and 32 x 32 matrices without a device and BENCH_TWEENS which is run with
+ * 8, 64 and 256 tweens, and writes one LOG_BENCH record per result to the
+ * event log.  The colors array for each size is allocated from the heap
+ * while that size runs, so sizes that do not fit in the memory of the
+ * board are reported with zero iterations instead.  Each benchmark builds
+ * only the light show it times, on the stack, so the stack needs room for
+ * one light show next to the heap.
+ *
+ * The host side decoder can turn the results into JSON and compare them
+ * against a saved baseline, @see extras/LogDecoder.cpp.  All the sizes can
+ * be run on a host, @see extras/HostBenchmark.cpp.
+ *
+ * The benchmarks use a BufferDevice so no data is sent to the LED units
+ * and the running light show is not disturbed, other than being paused
+ * while the benchmarks run.
+ */
+class Benchmark
+{
+	private:
+		/**
+		 * The numbers of LEDs each benchmark is run at.
+		 */
+		static const int  SIZES[];
+
+		/**
+		 * The number of elements in the SIZES array.
+		 */
+		static const int  MAX_SIZES;
+
+		/**
+		 * The numbers of tweens BENCH_TWEENS is run with.
+		 */
+		static const int  TWEEN_COUNTS[];
+
+		/**
+		 * The number of elements in the TWEEN_COUNTS array.
+		 */
+		static const int  MAX_TWEEN_COUNTS;
+
+		/**
+		 * Runs one benchmark for a number of iterations.
+		 *
+		 * @param bench       The BenchCase to run.
+		 * @param dLEDs       The device to run it on.
+		 * @param iterations  The number of times to repeat the operation.
+		 *
+		 * @return Returns the time taken, in microseconds or in cycles when
+		 *         Benchmark_CYCLES is set.
+		 */
+		static unsigned long time( uint8_t bench, BufferDevice * dLEDs, unsigned long iterations );
+
+		/**
+		 * Runs one of the XYMap benchmarks for a number of iterations.  Each
+		 * iteration looks up every cell of the matrix.
+		 *
+		 * @param bench       BENCH_XY_TABLE or BENCH_XY_COMPUTED.
+		 * @param map         The map to look the cells up in.
+		 * @param iterations  The number of times to repeat the lookups.
+		 *
+		 * @return Returns the time taken, as for time().
+		 */
+		static unsigned long timeMap( uint8_t bench, XYMap * map, unsigned long iterations );
+
+		/**
+		 * Runs BENCH_TWEENS for a number of iterations.  Each iteration
+		 * moves every tween by one 10 ms frame.
+		 *
+		 * @param tweens      The tweens.
+		 * @param nTweens     The number of tweens.
+		 * @param iterations  The number of frames.
+		 *
+		 * @return Returns the time taken, as for time().
+		 */
+		static unsigned long timeTweens( Tween * tweens, uint16_t nTweens, unsigned long iterations );
+
+		/**
+		 * Runs one benchmark long enough to get a stable result and writes
+		 * the result to the event log.
+		 *
+		 * @param bench    The BenchCase to run.
+		 * @param dLEDs    The device to run it on, or NULL for an XYMap or
+		 *                 tween case.
+		 * @param map      The map for an XYMap case, otherwise NULL.
+		 * @param tweens   The tweens for BENCH_TWEENS, otherwise NULL.
+		 * @param nTweens  The number of tweens.
+		 */
+		static void measure( uint8_t bench, BufferDevice * dLEDs, XYMap * map = NULL,
+		                     Tween * tweens = NULL, uint16_t nTweens = 0 );
+
+	public:
+		/**
+		 * Runs every benchmark at every size and writes the results to the
+		 * event log.  This takes several seconds.
+		 */
+		static void run();
+};
+
+#endif /* BENCHMARK_H_ */
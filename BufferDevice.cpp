@@ -0,0 +1,28 @@
+/*
+ * BufferDevice.cpp
+ *
+ *  Created on: Oct 18, 2026
+ *      Author: Steven F. LeBrun
+ */
+
+#include "BufferDevice.h"
+
+BufferDevice::BufferDevice( int nLEDs, CRGB * lights ) :
+	LedDevice(nLEDs, BufferDevice_NO_PIN, lights), estimateWire(false)
+{
+}
+
+BufferDevice::~BufferDevice()
+{
+}
+
+void BufferDevice::show()
+{
+	showTime.record( estimateWire ? wireTime() : 0 );
+}
+
+void BufferDevice::setSegments( int nSegments )
+{
+	estimateWire = ( nSegments > 0 );
+	segments     = estimateWire ? nSegments : 1;
+}
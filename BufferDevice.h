@@ -0,0 +1,77 @@
+/**
+ * Class derived from LedDevice to represent a set of LED units that only
+ * exists in memory.
+ *
+ *  @date   Created on October 18, 2026
+ *  @author Steven F. LeBrun
+ *  <br/><br/>
+ */
+
+#ifndef BUFFERDEVICE_H_
+#define BUFFERDEVICE_H_
+
+#include "LedDevice.h"
+
+/**
+ * The data pin reported for a device that is not connected to a pin.
+ */
+#define  BufferDevice_NO_PIN  -1
+
+/**
+ * Class derived from LedDevice that has an array of colors but no physical
+ * LED units.  Light shows can run on it exactly as they do on a real device
+ * which allows them to be measured without the cost of sending data to the
+ * LED units, or their output to be used as the input of something else.
+ *
+ * Unlike LedRing and LedStrip, the array of colors is supplied by the
+ * creator of the object, so the number of LED units can be chosen at run
+ * time.  The array must remain valid for the lifetime of the object.
+ *
+ * A BufferDevice can also stand in for a real device when measuring
+ * output.  When split into segments with setSegments(), show() records
+ * the estimated wire time of the segments if sent in parallel, @see
+ * LedDevice::wireTime().  Nothing is sent or timed; the figure is only
+ * the estimate, which gives the expected effect of splitting a long strip
+ * without the hardware.
+ */
+class BufferDevice: public LedDevice
+{
+	private:
+		/**
+		 * Set to @b true when show() records the estimated wire time.
+		 */
+		bool  estimateWire;
+
+	public:
+		/**
+		 * Constructor.
+		 *
+		 * @param nLEDs   The number of LED units in the device.
+		 * @param lights  An array of colors, one element for each LED unit.
+		 */
+		BufferDevice( int nLEDs, CRGB * lights );
+
+		/**
+		 * Destructor.  The array of colors is owned by the creator of this
+		 * object and is not released.
+		 */
+		virtual ~BufferDevice();
+
+		/**
+		 * There are no LED units to send the colors to, so this only updates
+		 * the show() counters of the device.  The time recorded is zero, or
+		 * the estimated wire time if setSegments() has been called.
+		 */
+		virtual void show();
+
+		/**
+		 * Makes show() record the estimated wire time of the LED units
+		 * split across several data pins that are sent in parallel.
+		 *
+		 * @param nSegments  The number of data pins to assume.  A value of
+		 *                   zero turns the estimate off.
+		 */
+		void setSegments( int nSegments );
+};
+
+#endif /* BUFFERDEVICE_H_ */
@@ -0,0 +1,21 @@
+/*
+ * Clock.cpp
+ *
+ *  Created on: Oct 18, 2026
+ *      Author: Steven F. LeBrun
+ */
+
+#include "Clock.h"
+#include "HardwareClock.h"
+
+/**
+ * The clock used until another one is installed.
+ */
+static HardwareClock  hardwareClock;
+
+Clock * Clock::current = &hardwareClock;
+
+void Clock::use( Clock * clock )
+{
+	current = ( clock != NULL ) ? clock : &hardwareClock;
+}
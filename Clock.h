@@ -0,0 +1,95 @@
+/**
+ * Abstract base class for the source of time used by the sketch.
+ *
+ *  @date   Created on October 18, 2026
+ *  @author Steven F. LeBrun
+ *  <br/><br/>
+ */
+
+#ifndef CLOCK_H_
+#define CLOCK_H_
+
+#include <Arduino.h>
+
+/**
+ * The source of time used by the light shows, the LED Devices, the event
+ * log and the mode button.  All of them read the time and wait through the
+ * static methods of this class rather than calling the Arduino millis(),
+ * micros() and delay() directly, so the clock can be replaced.
+ *
+ * The HardwareClock, which is used unless another clock is installed with
+ * use(), reads the Arduino timer.  A VirtualClock keeps time in a counter
+ * that jumps forward when waited on, so the sketch can run on a host as
+ * fast as it can render.
+ *
+ * The benchmarks measure the processor rather than the light shows and
+ * always read the Arduino timer.
+ */
+class Clock
+{
+	private:
+		/**
+		 * The clock read by the static methods.
+		 */
+		static Clock * current;
+
+	public:
+		/**
+		 * Destructor.
+		 */
+		virtual ~Clock() {};
+
+		/**
+		 * @return Returns the number of milliseconds since the clock started.
+		 */
+		virtual unsigned long readMillis() = 0;
+
+		/**
+		 * @return Returns the number of microseconds since the clock started.
+		 */
+		virtual unsigned long readMicros() = 0;
+
+		/**
+		 * Waits for a number of milliseconds.
+		 */
+		virtual void wait( unsigned long ms ) = 0;
+
+		/**
+		 * Waits for a number of microseconds.
+		 */
+		virtual void waitMicros( unsigned int us ) = 0;
+
+		/**
+		 * Installs the clock read by the static methods.
+		 *
+		 * @param clock  The new clock, or NULL for the HardwareClock.
+		 */
+		static void use( Clock * clock );
+
+		/**
+		 * @return Returns the clock read by the static methods.
+		 */
+		static Clock * installed() { return current; };
+
+		/**
+		 * Replaces the Arduino millis().
+		 */
+		static unsigned long millis() { return current->readMillis(); };
+
+		/**
+		 * Replaces the Arduino micros().
+		 */
+		static unsigned long micros() { return current->readMicros(); };
+
+		/**
+		 * Replaces the Arduino delay().
+		 */
+		static void delay( unsigned long ms ) { current->wait( ms ); };
+
+		/**
+		 * Replaces the Arduino delayMicroseconds().
+		 */
+		static void delayMicroseconds( unsigned int us ) { current->waitMicros( us ); };
+};
+
+#endif /* CLOCK_H_ */
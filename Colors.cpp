@@ -21,10 +21,79 @@ const CRGB  Colors::allColors[] =
 						CRGB::Purple
 				};
 
+const CRGB * const  Colors::noBlack    = allColors + 1;
+const CRGB * const  Colors::justColors = allColors + 2;
+
 const   int Colors::MAX_ALL_COLORS  = sizeof(allColors) / sizeof(CRGB);
 const   int Colors::MAX_NO_BLACK    = MAX_ALL_COLORS - 1;
 const   int Colors::MAX_JUST_COLORS = MAX_ALL_COLORS - 2;
 
+const uint8_t Colors::HUE_RAMP[256] PROGMEM =
+				{
+						255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+						255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+						255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 253, 247, 241, 235, 229,
+						223, 217, 211, 205, 199, 193, 187, 181, 175, 169, 163, 157, 151, 145, 139, 133,
+						127, 121, 115, 109, 103,  97,  91,  85,  79,  73,  67,  61,  55,  49,  43,  37,
+						 31,  25,  19,  13,   7,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+						  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+						  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+						  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+						  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+						  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   7,  13,  19,  25,
+						 31,  37,  43,  49,  55,  61,  67,  73,  79,  85,  91,  97, 103, 109, 115, 121,
+						127, 133, 139, 145, 151, 157, 163, 169, 175, 181, 187, 193, 199, 205, 211, 217,
+						223, 229, 235, 241, 247, 253, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+						255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+						255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255
+				};
+
+const uint8_t Colors::RAINBOW_PALETTE[] PROGMEM =
+				{
+						255,   0,   0,    255,  97,   0,    255, 193,   0,    223, 255,   0,
+						127, 255,   0,     31, 255,   0,      0, 255,  61,      0, 255, 157,
+						  0, 253, 253,      0, 157, 255,      0,  61, 255,     31,   0, 255,
+						127,   0, 255,    223,   0, 255,    255,   0, 193,    255,   0,  97
+				};
+
+const uint8_t Colors::HEAT_PALETTE[] PROGMEM =
+				{
+						  0,   0,   0,     51,   0,   0,    102,   0,   0,    153,   0,   0,
+						204,   0,   0,    255,   0,   0,    255,  51,   0,    255, 102,   0,
+						255, 153,   0,    255, 204,   0,    255, 255,   0,    255, 255,  51,
+						255, 255, 102,    255, 255, 153,    255, 255, 204,    255, 255, 255
+				};
+
+const uint8_t Colors::OCEAN_PALETTE[] PROGMEM =
+				{
+						  0,   0,  32,      0,   0,  88,      0,   0, 144,      0,   0, 199,
+						  0,   0, 255,      0,  40, 255,      0,  80, 255,      0, 120, 255,
+						  0, 160, 255,     32, 208, 255,     64, 255, 255,     32, 176, 208,
+						  0,  96, 160,      0,  64, 128,      0,  32,  96,      0,   0,  64
+				};
+
+const uint8_t Colors::PARTY_PALETTE[] PROGMEM =
+				{
+						 85,   0, 171,    142,   0, 135,    198,   0, 100,    255,   0,  64,
+						255,  43,  43,    255,  85,  21,    255, 128,   0,    255, 192,   0,
+						255, 255,   0,    170, 191,  85,     85, 128, 170,      0,  64, 255,
+						 21,  48, 234,     42,  32, 213,     64,  16, 192,     85,   0, 171
+				};
+
+/**
+ * Moves one channel from a towards b by frac / 16 of the difference.  Working
+ * on the difference keeps the product within 8 by 4 bits.
+ */
+static inline uint8_t lerp4( uint8_t a, uint8_t b, uint8_t frac )
+{
+	if ( b >= a )
+	{
+		return a + ( ( ( b - a ) * frac ) >> 4 );
+	}
+
+	return a - ( ( ( a - b ) * frac ) >> 4 );
+}
+
 
 Colors::Colors()
 {
@@ -71,5 +140,61 @@ CRGB  Colors::nextColor()
 	return getJustColor(cnt);
 }
 
+CRGB  Colors::paletteColor( const uint8_t * palette, uint8_t index )
+{
+	const uint8_t * entry = palette + 3 * ( index >> 4 );
+	const uint8_t * after = ( index >= 0xF0 ) ? palette : entry + 3;
+	uint8_t         frac  = index & 0x0F;
 
+	return CRGB( lerp4( pgm_read_byte(entry),     pgm_read_byte(after),     frac ),
+	             lerp4( pgm_read_byte(entry + 1), pgm_read_byte(after + 1), frac ),
+	             lerp4( pgm_read_byte(entry + 2), pgm_read_byte(after + 2), frac ) );
+}
+
+void  Colors::fillPalette( CRGB * leds, int n, const uint8_t * palette, uint8_t index, uint8_t step )
+{
+	int i;
+
+	for ( i = 0 ; i < n ; ++i )
+	{
+		leds[i] = paletteColor( palette, index );
+		index  += step;
+	}
+}
+
+CRGB  Colors::hsvColor( uint8_t hue, uint8_t sat, uint8_t val )
+{
+	uint8_t r = pgm_read_byte( &HUE_RAMP[hue] );
+	uint8_t g = pgm_read_byte( &HUE_RAMP[(uint8_t) ( hue - 85 )] );
+	uint8_t b = pgm_read_byte( &HUE_RAMP[(uint8_t) ( hue - 171 )] );
 
+	// Lower saturation mixes the hue with white.
+	if ( sat != 255 )
+	{
+		uint8_t white = 255 - sat;
+
+		r = scale8( r, sat ) + white;
+		g = scale8( g, sat ) + white;
+		b = scale8( b, sat ) + white;
+	}
+
+	if ( val != 255 )
+	{
+		r = scale8( r, val );
+		g = scale8( g, val );
+		b = scale8( b, val );
+	}
+
+	return CRGB( r, g, b );
+}
+
+void  Colors::fillRainbow( CRGB * leds, int n, uint8_t hue, uint8_t step )
+{
+	int i;
+
+	for ( i = 0 ; i < n ; ++i )
+	{
+		leds[i] = hsvColor( hue );
+		hue    += step;
+	}
+}
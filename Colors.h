@@ -29,6 +29,11 @@
 
 #include <FastLED.h>
 
+/**
+ * The number of colors in a gradient palette.  @see Colors::paletteColor()
+ */
+#define  Colors_PALETTE_SIZE  16
+
 
 class Colors
 {
@@ -53,13 +58,13 @@ class Colors
 		/**
 		 * The pointer to the array of Colors starting with the color White.
 		 */
-		static CRGB  * noBlack    = allColors + 1;
+		static const CRGB * const noBlack;
 
 		/**
 		 * The pointer to the array of Colors starting with the first color
 		 * after Black and White.
 		 */
-		static CRGB  * justColors = allColors + 2;
+		static const CRGB * const justColors;
 
 		/**
 		 * The number of elements in the allColors array.
@@ -90,7 +95,25 @@ class Colors
 		 */
 		int  cnt = MAX_JUST_COLORS -1;
 
+		/**
+		 * One color channel of a fully saturated hue, stored in flash.  The
+		 * red channel of hue h is HUE_RAMP[h], green is HUE_RAMP[h - 85] and
+		 * blue is HUE_RAMP[h - 171], with the index wrapping at 256.  Each
+		 * channel is full for a third of the color wheel, fades over a sixth
+		 * on either side and is off for the remaining third.
+		 */
+		static const uint8_t  HUE_RAMP[256];
+
 	public:
+		/**
+		 * Gradient palettes for paletteColor(), stored in flash.  Each one
+		 * holds Colors_PALETTE_SIZE colors as red, green and blue bytes.
+		 */
+		static const uint8_t  RAINBOW_PALETTE[];   ///< The color wheel in 16 steps.
+		static const uint8_t  HEAT_PALETTE[];      ///< Black, red, yellow, white.
+		static const uint8_t  OCEAN_PALETTE[];     ///< Deep blue through cyan and back.
+		static const uint8_t  PARTY_PALETTE[];     ///< Purple, red, orange, yellow, blue.
+
 		/**
 		 * Constructor.  Creates and initializes a non-static instance of this class.
 		 */
@@ -162,6 +185,61 @@ class Colors
 		 *          The order of colors returned is defined by the order in which they are stored.
 		 */
 		CRGB   nextColor();
+
+		/**
+		 * Non-Static method used to obtain the color last returned by
+		 * nextColor(), so a light show that is resumed can carry on with the
+		 * same color.
+		 *
+		 * @return  Returns the current color of the cursor.
+		 */
+		CRGB   currentColor() { return getJustColor(cnt); };
+
+		/**
+		 * Looks up a color in a gradient palette.  The top four bits of the
+		 * index select one of the Colors_PALETTE_SIZE colors and the bottom
+		 * four bits blend it towards the next one.  The last color blends
+		 * back into the first so the palette can be cycled without a seam.
+		 *
+		 * @param palette  A palette stored in flash, such as RAINBOW_PALETTE.
+		 * @param index    The position in the palette, [0..255].
+		 * @return Returns the interpolated color.
+		 */
+		static CRGB  paletteColor( const uint8_t * palette, uint8_t index );
+
+		/**
+		 * Sets an array of colors from a gradient palette.
+		 *
+		 * @param leds     The colors to set.
+		 * @param n        The number of colors to set.
+		 * @param palette  A palette stored in flash.
+		 * @param index    The palette position of the first color.
+		 * @param step     The amount the palette position moves for each color.
+		 */
+		static void  fillPalette( CRGB * leds, int n, const uint8_t * palette, uint8_t index, uint8_t step );
+
+		/**
+		 * Converts a hue, saturation and value to a color using integer
+		 * arithmetic and the HUE_RAMP table.  The hues are spaced evenly
+		 * around the color wheel, like FastLED's hsv2rgb_spectrum(), but
+		 * without the per-call branches on the hue section.
+		 *
+		 * @param hue  The hue, [0..255], 0 is red, 85 is green, 171 is blue.
+		 * @param sat  The saturation, 0 is white and 255 is the pure hue.
+		 * @param val  The brightness, 0 is black.
+		 * @return Returns the color.
+		 */
+		static CRGB  hsvColor( uint8_t hue, uint8_t sat = 255, uint8_t val = 255 );
+
+		/**
+		 * Sets an array of colors to a rainbow of fully saturated hues.
+		 *
+		 * @param leds     The colors to set.
+		 * @param n        The number of colors to set.
+		 * @param hue      The hue of the first color.
+		 * @param step     The amount the hue moves for each color.
+		 */
+		static void  fillRainbow( CRGB * leds, int n, uint8_t hue, uint8_t step );
 };
 
 #endif /* COLORS_H_ */
@@ -0,0 +1,363 @@
+/*
+ * Compositor.cpp
+ *
+ *  Created on: Oct 18, 2026
+ *      Author: Steven F. LeBrun
+ */
+
+#include <string.h>
+
+#include "Clock.h"
+#include "Compositor.h"
+#include "EventLog.h"
+
+/**
+ * The number of LED units of a shader layer evaluated at a time.  The
+ * colors are collected in a small array on the stack so that shader layers
+ * use the same blend kernels as light show layers.
+ */
+#define  Compositor_SHADER_CHUNK  16
+
+/**
+ * Copies the layer over the colors below it.
+ */
+static void blendReplace( CRGB * dst, const CRGB * src, int n )
+{
+	memcpy( dst, src, n * sizeof(CRGB) );
+}
+
+/**
+ * Adds each channel of the layer to the colors below it, saturating at 255.
+ */
+static void blendAdd( CRGB * dst, const CRGB * src, int n )
+{
+	for ( int i = 0 ; i < n ; ++i )
+	{
+		dst[i].r = qadd8( dst[i].r, src[i].r );
+		dst[i].g = qadd8( dst[i].g, src[i].g );
+		dst[i].b = qadd8( dst[i].b, src[i].b );
+	}
+}
+
+/**
+ * Keeps the brighter of each channel.
+ */
+static void blendMax( CRGB * dst, const CRGB * src, int n )
+{
+	for ( int i = 0 ; i < n ; ++i )
+	{
+		if ( src[i].r > dst[i].r ) dst[i].r = src[i].r;
+		if ( src[i].g > dst[i].g ) dst[i].g = src[i].g;
+		if ( src[i].b > dst[i].b ) dst[i].b = src[i].b;
+	}
+}
+
+/**
+ * Moves one channel towards the layer by alpha / 256 of the difference.
+ * Working on the difference keeps the product within 8 bits.
+ */
+static inline uint8_t mix8( uint8_t below, uint8_t above, uint8_t alpha )
+{
+	if ( above >= below )
+	{
+		return below + scale8( above - below, alpha );
+	}
+
+	return below - scale8( below - above, alpha );
+}
+
+/**
+ * Mixes the layer with the colors below it by the opacity of the layer.
+ */
+static void blendAlpha( CRGB * dst, const CRGB * src, int n, uint8_t alpha )
+{
+	for ( int i = 0 ; i < n ; ++i )
+	{
+		dst[i].r = mix8( dst[i].r, src[i].r, alpha );
+		dst[i].g = mix8( dst[i].g, src[i].g, alpha );
+		dst[i].b = mix8( dst[i].b, src[i].b, alpha );
+	}
+}
+
+/**
+ * Blends an array of colors with one of the kernels above.
+ */
+static void blend( uint8_t mode, uint8_t alpha, CRGB * dst, const CRGB * src, int n )
+{
+	switch ( mode )
+	{
+		case BLEND_ADD:
+			blendAdd( dst, src, n );
+			break;
+
+		case BLEND_MAX:
+			blendMax( dst, src, n );
+			break;
+
+		case BLEND_ALPHA:
+			blendAlpha( dst, src, n, alpha );
+			break;
+
+		default:
+			blendReplace( dst, src, n );
+			break;
+	}
+}
+
+Compositor::Compositor( LedDevice * dLEDs, CRGB * cache ) :
+	LightShow(dLEDs, Compositor_SHADER_DELAY), nLayers(0), cache(cache), cachedLayers(0)
+{
+}
+
+Compositor::~Compositor()
+{
+}
+
+bool Compositor::addLayer( LightShow * show, uint8_t mode, uint8_t alpha )
+{
+	if ( nLayers >= Compositor_MAX_LAYERS
+	     || show->getLedDevice()->numberOfLEDs() < device->numberOfLEDs() )
+	{
+		return false;
+	}
+
+	Layer &  layer = layers[nLayers++];
+
+	layer.show   = show;
+	layer.source = show->getLedDevice();
+	layer.shader = NULL;
+	layer.mode   = mode;
+	layer.alpha  = alpha;
+	layer.dirty  = true;
+	layer.due    = 0;
+
+	return true;
+}
+
+bool Compositor::addLayer( LayerShader shader, uint8_t mode, uint8_t alpha )
+{
+	if ( nLayers >= Compositor_MAX_LAYERS )
+	{
+		return false;
+	}
+
+	Layer &  layer = layers[nLayers++];
+
+	layer.show   = NULL;
+	layer.source = NULL;
+	layer.shader = shader;
+	layer.mode   = mode;
+	layer.alpha  = alpha;
+	layer.dirty  = true;
+	layer.due    = 0;
+
+	return true;
+}
+
+void Compositor::start()
+{
+	unsigned long  now = Clock::millis();
+
+	frameDelay   = Compositor_SHADER_DELAY;
+	cachedLayers = 0;
+
+	for ( uint8_t l = 0 ; l < nLayers ; ++l )
+	{
+		Layer &  layer = layers[l];
+
+		layer.dirty = true;
+		layer.due   = now;
+
+		if ( layer.show != NULL )
+		{
+			layer.source->setLEDsBackground();
+			layer.show->start();
+
+			if ( l == 0 || layer.show->getFrameDelay() < frameDelay )
+			{
+				frameDelay = layer.show->getFrameDelay();
+			}
+		}
+	}
+}
+
+void Compositor::resume()
+{
+	unsigned long  now = Clock::millis();
+
+	cachedLayers = 0;
+
+	for ( uint8_t l = 0 ; l < nLayers ; ++l )
+	{
+		layers[l].dirty = true;
+		layers[l].due   = now;
+
+		if ( layers[l].show != NULL )
+		{
+			layers[l].show->resume();
+		}
+	}
+}
+
+void Compositor::setQuality( uint8_t level )
+{
+	LightShow::setQuality( level );
+
+	for ( uint8_t l = 0 ; l < nLayers ; ++l )
+	{
+		if ( layers[l].show != NULL )
+		{
+			layers[l].show->setQuality( level );
+		}
+	}
+}
+
+bool Compositor::nextFrame()
+{
+	unsigned long  now     = Clock::millis();
+	int            maxLEDs = device->numberOfLEDs();
+	CRGB *         target  = device->getLEDs();
+	uint8_t        lowest  = nLayers;
+	uint8_t        l;
+
+	// Render the layers that are due and find the lowest one that changed.
+	for ( l = 0 ; l < nLayers ; ++l )
+	{
+		Layer &  layer = layers[l];
+
+		if ( layer.show == NULL )
+		{
+			layer.dirty = true;
+		}
+		else
+		{
+			if ( (long) ( now - layer.due ) >= 0 )
+			{
+				if ( ! layer.show->nextFrame() )
+				{
+					layer.show->start();
+				}
+
+				layer.due += layer.show->getFrameDelay();
+
+				// A layer that fell behind starts again from now rather
+				// than rendering several frames to catch up.
+				if ( (long) ( now - layer.due ) >= 0 )
+				{
+					layer.due = now + layer.show->getFrameDelay();
+				}
+			}
+
+			if ( layer.source->isChanged() )
+			{
+				layer.source->clearChanged();
+				layer.dirty = true;
+			}
+		}
+
+		if ( layer.dirty && lowest == nLayers )
+		{
+			lowest = l;
+		}
+	}
+
+	if ( lowest == nLayers )
+	{
+		return true;
+	}
+
+	if ( cache == NULL )
+	{
+		lowest = 0;
+	}
+	else
+	{
+		// The cache holds a dirty layer, so it has to be built again.
+		if ( lowest < cachedLayers )
+		{
+			cachedLayers = 0;
+		}
+
+		// Fold the clean layers below the lowest dirty one into the cache.
+		for ( ; cachedLayers < lowest ; ++cachedLayers )
+		{
+			if ( cachedLayers == 0 )
+			{
+				fill_solid( cache, maxLEDs, CRGB::Black );
+			}
+
+			blendLayer( layers[cachedLayers], cache, now );
+		}
+	}
+
+	if ( lowest == 0 )
+	{
+		fill_solid( target, maxLEDs, CRGB::Black );
+	}
+	else
+	{
+		memcpy( target, cache, maxLEDs * sizeof(CRGB) );
+	}
+
+	for ( l = lowest ; l < nLayers ; ++l )
+	{
+		blendLayer( layers[l], target, now );
+	}
+
+	return true;
+}
+
+void Compositor::blendLayer( Layer & layer, CRGB * target, unsigned long now )
+{
+	unsigned long  start   = Clock::micros();
+	int            maxLEDs = device->numberOfLEDs();
+
+	if ( layer.show != NULL )
+	{
+		blend( layer.mode, layer.alpha, target, layer.source->getLEDs(), maxLEDs );
+	}
+	else
+	{
+		CRGB  colors[Compositor_SHADER_CHUNK];
+
+		for ( int first = 0 ; first < maxLEDs ; first += Compositor_SHADER_CHUNK )
+		{
+			int  n = maxLEDs - first;
+
+			if ( n > Compositor_SHADER_CHUNK )
+			{
+				n = Compositor_SHADER_CHUNK;
+			}
+
+			for ( int i = 0 ; i < n ; ++i )
+			{
+				colors[i] = layer.shader( first + i, now );
+			}
+
+			blend( layer.mode, layer.alpha, target + first, colors, n );
+		}
+	}
+
+	layer.dirty = false;
+	layer.cost.record( Clock::micros() - start );
+}
+
+void Compositor::report()
+{
+	LightShow::report();
+
+	for ( uint8_t l = 0 ; l < nLayers ; ++l )
+	{
+		layers[l].cost.log( LOG_PERF_LAYER, l );
+	}
+}
+
+void Compositor::resetCounters()
+{
+	LightShow::resetCounters();
+
+	for ( uint8_t l = 0 ; l < nLayers ; ++l )
+	{
+		layers[l].cost.reset();
+	}
+}
@@ -0,0 +1,239 @@
+/**
+ * Light Show that stacks several layers, each one a light show or a
+ * procedural source, and blends them onto one LED Device.
+ *
+ *  @date   Created on October 18, 2026
+ *  @author Steven F. LeBrun
+ *  <br/><br/>
+ */
+
+#ifndef COMPOSITOR_H_
+#define COMPOSITOR_H_
+
+#include "BufferDevice.h"
+#include "LedDevice.h"
+#include "LightShow.h"
+#include "TimingStats.h"
+
+/**
+ * The largest number of layers a Compositor can hold.
+ */
+#define  Compositor_MAX_LAYERS    4
+
+/**
+ * The frame time, in milliseconds, used when every layer is procedural.
+ */
+#define  Compositor_SHADER_DELAY  20
+
+/**
+ * How the colors of a layer are combined with the layers below it.
+ */
+enum BlendMode
+{
+	BLEND_REPLACE = 0,   ///< The layer hides everything below it.
+	BLEND_ADD     = 1,   ///< Each channel is added, saturating at 255.
+	BLEND_MAX     = 2,   ///< Each channel is the brighter of the two.
+	BLEND_ALPHA   = 3    ///< Mixed with the layers below by the layer alpha.
+};
+
+/**
+ * A procedural layer.  Called once for each LED unit of each frame.
+ *
+ * @param index  The offset of the LED unit.
+ * @param now    The millis() value of the frame.
+ * @return Returns the color of the LED unit.
+ */
+typedef CRGB (*LayerShader)( int index, unsigned long now );
+
+/**
+ * Light Show derived class that combines other light shows.
+ *
+ * A layer is either a light show that runs on its own BufferDevice, or a
+ * LayerShader function.  Each light show layer renders at its own frame
+ * time, and the Compositor runs at the shortest frame time of its layers.
+ * The layers are blended from the bottom, layer 0, to the top.
+ *
+ * A light show layer is only marked dirty when its BufferDevice has
+ * changed.  If a cache array is supplied, the blend of the clean layers
+ * below the lowest dirty layer is kept in the cache, so a static
+ * background under a moving layer is not blended again on every frame.
+ * Layers above a dirty layer still have to be blended, and shader layers
+ * are dirty on every frame.  When no layer is dirty nothing is blended and
+ * the device keeps its last frame, so a double buffered device must retain
+ * the shown frame, @see LedDevice::setBackBuffer().
+ *
+ * The blend kernels work on 8 bit channels with the FastLED qadd8() and
+ * scale8() functions and do not use any multiplication wider than 8 bits.
+ *
+ * The time taken to blend each layer is recorded and reported as one
+ * LOG_PERF_LAYER record per layer.
+ */
+class Compositor: public LightShow
+{
+	private:
+		/**
+		 * The state kept for each layer.
+		 */
+		struct Layer
+		{
+			/**
+			 * The light show of the layer, or NULL for a shader layer.
+			 */
+			LightShow *    show;
+
+			/**
+			 * The colors the light show renders into.  Taken from the
+			 * light show when the layer is added.
+			 */
+			LedDevice *    source;
+
+			/**
+			 * The function of a shader layer, or NULL for a light show layer.
+			 */
+			LayerShader    shader;
+
+			/**
+			 * One of the BlendMode values.
+			 */
+			uint8_t        mode;
+
+			/**
+			 * The opacity used by BLEND_ALPHA, 255 is fully opaque.
+			 */
+			uint8_t        alpha;
+
+			/**
+			 * Set to @b true when the layer has to be blended again.
+			 */
+			bool           dirty;
+
+			/**
+			 * The millis() value at which the light show renders its next frame.
+			 */
+			unsigned long  due;
+
+			/**
+			 * The time, in microseconds, taken to blend this layer.
+			 */
+			TimingStats    cost;
+		};
+
+		/**
+		 * The layers, bottom first.
+		 */
+		Layer   layers[Compositor_MAX_LAYERS];
+
+		/**
+		 * The number of layers in use.
+		 */
+		uint8_t nLayers;
+
+		/**
+		 * The blend of the layers below cachedLayers, or NULL if there is
+		 * no cache.  Has one element for each LED unit of the device.
+		 */
+		CRGB *  cache;
+
+		/**
+		 * The number of layers blended into the cache.
+		 */
+		uint8_t cachedLayers;
+
+	public:
+		/**
+		 * Constructor.
+		 *
+		 * @param dLEDs  Pointer to the LED Device the layers are blended onto.
+		 * @param cache  An array with one element for each LED unit of the
+		 *               device, used to keep the blend of the clean layers.
+		 *               May be NULL to save memory, in which case every
+		 *               layer is blended whenever any layer changes.
+		 */
+		Compositor( LedDevice * dLEDs, CRGB * cache = NULL );
+
+		/**
+		 * Destructor.  The layers and the cache are owned by the creator
+		 * of this object and are not released.
+		 */
+		virtual ~Compositor();
+
+		/**
+		 * Adds a light show layer on top of the existing layers.  The light
+		 * show must run on a BufferDevice with at least as many LED units
+		 * as the device of the Compositor.  A light show that finishes is
+		 * started again.
+		 *
+		 * @param show   The light show of the layer.
+		 * @param mode   One of the BlendMode values.
+		 * @param alpha  The opacity of the layer for BLEND_ALPHA.
+		 * @return Returns @b false if there is no room for another layer.
+		 */
+		bool addLayer( LightShow * show, uint8_t mode = BLEND_REPLACE, uint8_t alpha = 255 );
+
+		/**
+		 * Adds a shader layer on top of the existing layers.
+		 *
+		 * @param shader The function that provides the colors of the layer.
+		 * @param mode   One of the BlendMode values.
+		 * @param alpha  The opacity of the layer for BLEND_ALPHA.
+		 * @return Returns @b false if there is no room for another layer.
+		 */
+		bool addLayer( LayerShader shader, uint8_t mode = BLEND_REPLACE, uint8_t alpha = 255 );
+
+		/**
+		 * Starts the light show of every layer and sets the frame time to
+		 * the shortest frame time of the layers.
+		 */
+		virtual void start();
+
+		/**
+		 * Marks every layer dirty so the next frame blends them all again,
+		 * and resumes the light show of each layer.  The layers keep their
+		 * colors in their own buffers, so nothing else has to be repainted.
+		 */
+		virtual void resume();
+
+		/**
+		 * Sets the quality level of the Compositor and of the light show of
+		 * each layer.
+		 *
+		 * @param level  One of the QualityLevel values.
+		 */
+		virtual void setQuality( uint8_t level );
+
+		/**
+		 * Renders the layers that are due and blends the layers that have
+		 * changed onto the device.
+		 *
+		 * @return Always returns @b true.
+		 */
+		virtual bool nextFrame();
+
+		/**
+		 * @return Returns SHOW_COMPOSITOR.
+		 */
+		virtual uint8_t getShowType() { return SHOW_COMPOSITOR; };
+
+		/**
+		 * Writes the counters of the Compositor followed by a LOG_PERF_LAYER
+		 * record for each layer.
+		 */
+		virtual void report();
+
+		/**
+		 * Sets the counters of the Compositor and of each layer back to zero.
+		 */
+		virtual void resetCounters();
+
+	private:
+		/**
+		 * Blends one layer onto an array of colors.
+		 *
+		 * @param layer  The layer to blend.
+		 * @param target The colors of the layers below, replaced by the result.
+		 * @param now    The millis() value of the frame, passed to shaders.
+		 */
+		void blendLayer( Layer & layer, CRGB * target, unsigned long now );
+};
+
+#endif /* COMPOSITOR_H_ */
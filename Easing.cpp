@@ -0,0 +1,89 @@
+/*
+ * Easing.cpp
+ *
+ *  Created on: Oct 18, 2026
+ *      Author: Steven F. LeBrun
+ */
+
+#include "Easing.h"
+
+// Generated by extras/EasingGen.cpp.
+const uint8_t Easing::TABLES[EASE_CURVES - 1][256] PROGMEM =
+{
+	// EASE_IN
+	{
+		  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   1,   1,   1,   1,
+		  1,   1,   1,   1,   2,   2,   2,   2,   2,   2,   3,   3,   3,   3,   4,   4,
+		  4,   4,   5,   5,   5,   5,   6,   6,   6,   7,   7,   7,   8,   8,   8,   9,
+		  9,   9,  10,  10,  11,  11,  11,  12,  12,  13,  13,  14,  14,  15,  15,  16,
+		 16,  17,  17,  18,  18,  19,  19,  20,  20,  21,  21,  22,  23,  23,  24,  24,
+		 25,  26,  26,  27,  28,  28,  29,  30,  30,  31,  32,  32,  33,  34,  35,  35,
+		 36,  37,  38,  38,  39,  40,  41,  42,  42,  43,  44,  45,  46,  47,  47,  48,
+		 49,  50,  51,  52,  53,  54,  55,  56,  56,  57,  58,  59,  60,  61,  62,  63,
+		 64,  65,  66,  67,  68,  69,  70,  71,  73,  74,  75,  76,  77,  78,  79,  80,
+		 81,  82,  84,  85,  86,  87,  88,  89,  91,  92,  93,  94,  95,  97,  98,  99,
+		100, 102, 103, 104, 105, 107, 108, 109, 111, 112, 113, 115, 116, 117, 119, 120,
+		121, 123, 124, 126, 127, 128, 130, 131, 133, 134, 136, 137, 139, 140, 142, 143,
+		145, 146, 148, 149, 151, 152, 154, 155, 157, 158, 160, 162, 163, 165, 166, 168,
+		170, 171, 173, 175, 176, 178, 180, 181, 183, 185, 186, 188, 190, 192, 193, 195,
+		197, 199, 200, 202, 204, 206, 207, 209, 211, 213, 215, 217, 218, 220, 222, 224,
+		226, 228, 230, 232, 233, 235, 237, 239, 241, 243, 245, 247, 249, 251, 253, 255
+	},
+	// EASE_OUT
+	{
+		  0,   2,   4,   6,   8,  10,  12,  14,  16,  18,  20,  22,  23,  25,  27,  29,
+		 31,  33,  35,  37,  38,  40,  42,  44,  46,  48,  49,  51,  53,  55,  56,  58,
+		 60,  62,  63,  65,  67,  69,  70,  72,  74,  75,  77,  79,  80,  82,  84,  85,
+		 87,  89,  90,  92,  93,  95,  97,  98, 100, 101, 103, 104, 106, 107, 109, 110,
+		112, 113, 115, 116, 118, 119, 121, 122, 124, 125, 127, 128, 129, 131, 132, 134,
+		135, 136, 138, 139, 140, 142, 143, 144, 146, 147, 148, 150, 151, 152, 153, 155,
+		156, 157, 158, 160, 161, 162, 163, 164, 166, 167, 168, 169, 170, 171, 173, 174,
+		175, 176, 177, 178, 179, 180, 181, 182, 184, 185, 186, 187, 188, 189, 190, 191,
+		192, 193, 194, 195, 196, 197, 198, 199, 199, 200, 201, 202, 203, 204, 205, 206,
+		207, 208, 208, 209, 210, 211, 212, 213, 213, 214, 215, 216, 217, 217, 218, 219,
+		220, 220, 221, 222, 223, 223, 224, 225, 225, 226, 227, 227, 228, 229, 229, 230,
+		231, 231, 232, 232, 233, 234, 234, 235, 235, 236, 236, 237, 237, 238, 238, 239,
+		239, 240, 240, 241, 241, 242, 242, 243, 243, 244, 244, 244, 245, 245, 246, 246,
+		246, 247, 247, 247, 248, 248, 248, 249, 249, 249, 250, 250, 250, 250, 251, 251,
+		251, 251, 252, 252, 252, 252, 253, 253, 253, 253, 253, 253, 254, 254, 254, 254,
+		254, 254, 254, 254, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255
+	},
+	// EASE_IN_OUT
+	{
+		  0,   0,   0,   0,   0,   0,   0,   1,   1,   1,   1,   1,   2,   2,   2,   3,
+		  3,   3,   4,   4,   4,   5,   5,   6,   6,   7,   7,   8,   9,   9,  10,  10,
+		 11,  12,  12,  13,  14,  15,  15,  16,  17,  18,  18,  19,  20,  21,  22,  23,
+		 24,  25,  26,  27,  27,  28,  29,  30,  31,  33,  34,  35,  36,  37,  38,  39,
+		 40,  41,  42,  44,  45,  46,  47,  48,  50,  51,  52,  53,  54,  56,  57,  58,
+		 60,  61,  62,  63,  65,  66,  67,  69,  70,  72,  73,  74,  76,  77,  78,  80,
+		 81,  83,  84,  85,  87,  88,  90,  91,  93,  94,  96,  97,  98, 100, 101, 103,
+		104, 106, 107, 109, 110, 112, 113, 115, 116, 118, 119, 121, 122, 124, 125, 127,
+		128, 130, 131, 133, 134, 136, 137, 139, 140, 142, 143, 145, 146, 148, 149, 151,
+		152, 154, 155, 157, 158, 159, 161, 162, 164, 165, 167, 168, 170, 171, 172, 174,
+		175, 177, 178, 179, 181, 182, 183, 185, 186, 188, 189, 190, 192, 193, 194, 195,
+		197, 198, 199, 201, 202, 203, 204, 205, 207, 208, 209, 210, 211, 213, 214, 215,
+		216, 217, 218, 219, 220, 221, 222, 224, 225, 226, 227, 228, 228, 229, 230, 231,
+		232, 233, 234, 235, 236, 237, 237, 238, 239, 240, 240, 241, 242, 243, 243, 244,
+		245, 245, 246, 246, 247, 248, 248, 249, 249, 250, 250, 251, 251, 251, 252, 252,
+		252, 253, 253, 253, 254, 254, 254, 254, 254, 255, 255, 255, 255, 255, 255, 255
+	},
+	// EASE_BOUNCE
+	{
+		  0,   0,   0,   0,   0,   1,   1,   1,   2,   2,   3,   4,   4,   5,   6,   7,
+		  8,   9,  10,  11,  12,  13,  14,  16,  17,  19,  20,  22,  23,  25,  27,  29,
+		 30,  32,  34,  36,  38,  41,  43,  45,  47,  50,  52,  55,  57,  60,  63,  66,
+		 68,  71,  74,  77,  80,  83,  86,  90,  93,  96, 100, 103, 107, 110, 114, 118,
+		121, 125, 129, 133, 137, 141, 145, 150, 154, 158, 162, 167, 171, 176, 180, 185,
+		190, 195, 199, 204, 209, 214, 219, 224, 230, 235, 240, 246, 251, 254, 252, 249,
+		246, 244, 241, 239, 237, 234, 232, 230, 228, 226, 224, 222, 220, 218, 216, 215,
+		213, 211, 210, 208, 207, 206, 204, 203, 202, 201, 200, 199, 198, 197, 196, 196,
+		195, 194, 194, 193, 193, 192, 192, 192, 192, 191, 191, 191, 191, 191, 192, 192,
+		192, 192, 193, 193, 194, 194, 195, 195, 196, 197, 198, 199, 200, 201, 202, 203,
+		204, 205, 207, 208, 210, 211, 213, 214, 216, 218, 220, 221, 223, 225, 227, 229,
+		232, 234, 236, 238, 241, 243, 246, 248, 251, 254, 254, 253, 252, 250, 249, 248,
+		247, 246, 245, 245, 244, 243, 242, 242, 241, 241, 240, 240, 240, 239, 239, 239,
+		239, 239, 239, 239, 239, 240, 240, 240, 241, 241, 242, 242, 243, 244, 244, 245,
+		246, 247, 248, 249, 250, 251, 253, 254, 255, 254, 254, 253, 253, 252, 252, 252,
+		251, 251, 251, 251, 251, 251, 251, 251, 252, 252, 252, 253, 253, 254, 254, 255
+	}
+};
@@ -0,0 +1,71 @@
+/**
+ * Easing curves for the Animator, kept as 8 bit tables in flash.
+ *
+ *  @date   Created on October 18, 2026
+ *  @author Steven F. LeBrun
+ *  <br/><br/>
+ */
+
+#ifndef EASING_H_
+#define EASING_H_
+
+#include <Arduino.h>
+
+/**
+ * The easing curves.  Each one maps how far through a tween it is to how
+ * far the value has moved, both from 0 to 1.
+ */
+enum EasingCurve
+{
+	EASE_LINEAR  = 0,  ///< Moves at a steady speed.
+	EASE_IN      = 1,  ///< Starts slowly and speeds up.
+	EASE_OUT     = 2,  ///< Starts quickly and slows down.
+	EASE_IN_OUT  = 3,  ///< Starts and ends slowly.
+	EASE_BOUNCE  = 4,  ///< Falls onto the end and bounces.
+	EASE_CURVES  = 5   ///< The number of curves, not a curve.
+};
+
+/**
+ * Looks up the easing curves.  Each curve other than EASE_LINEAR is a table
+ * of 256 bytes in flash, made by extras/EasingGen.cpp, and ease() blends
+ * between neighbouring entries so that a long tween moves in steps finer
+ * than 1/256.  The lookup is a couple of flash reads and a multiply, with
+ * no floating point.
+ */
+class Easing
+{
+	public:
+		/**
+		 * The curves after EASE_LINEAR, in the order of the EasingCurve
+		 * values.  Entry i is the eased value of i / 255, scaled to 255.
+		 */
+		static const uint8_t  TABLES[EASE_CURVES - 1][256];
+
+		/**
+		 * Eases a value.  Inline, since the Animator calls it for every tween
+		 * on every frame.
+		 *
+		 * @param curve     One of the EasingCurve values.
+		 * @param progress  How far through the tween, from 0 to 65535.
+		 *
+		 * @return Returns how far the value has moved, from 0 to 65535.
+		 */
+		static uint16_t ease( uint8_t curve, uint16_t progress )
+		{
+			if ( curve == EASE_LINEAR || curve >= EASE_CURVES )
+			{
+				return progress;
+			}
+
+			const uint8_t *  table = TABLES[curve - 1];
+			uint8_t          i     = progress >> 8;
+			int16_t          here  = pgm_read_byte( table + i );
+			int16_t          next  = ( i == 255 ) ? 256 : pgm_read_byte( table + i + 1 );
+
+			// Neighbouring entries differ by less than 128, so the step
+			// times the fraction fits in 16 bits.
+			return ( (uint16_t) here << 8 ) + ( next - here ) * (int16_t) ( progress & 0xFF );
+		};
+};
+
+#endif /* EASING_H_ */
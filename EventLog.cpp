@@ -0,0 +1,113 @@
+/*
+ * EventLog.cpp
+ *
+ *  Created on: Oct 18, 2026
+ *      Author: Steven F. LeBrun
+ */
+
+#include "Clock.h"
+#include "EventLog.h"
+
+uint8_t                 EventLog::buffer[EventLog_BUFFER_SIZE];
+volatile uint8_t        EventLog::head      = 0;
+volatile uint8_t        EventLog::tail      = 0;
+volatile uint16_t       EventLog::dropped   = 0;
+volatile unsigned long  EventLog::lastWrite = 0;
+
+void EventLog::put( uint8_t event, uint16_t stamp, uint8_t nArgs, const uint16_t * args )
+{
+	uint8_t  h    = head;
+	uint8_t  mask = EventLog_BUFFER_SIZE - 1;
+	uint8_t  i;
+
+	buffer[h] = EventLog_SYNC;          h = ( h + 1 ) & mask;
+	buffer[h] = event;                  h = ( h + 1 ) & mask;
+	buffer[h] = nArgs;                  h = ( h + 1 ) & mask;
+	buffer[h] = lowByte(stamp);         h = ( h + 1 ) & mask;
+	buffer[h] = highByte(stamp);        h = ( h + 1 ) & mask;
+
+	for ( i = 0 ; i < nArgs ; ++i )
+	{
+		buffer[h] = lowByte(args[i]);   h = ( h + 1 ) & mask;
+		buffer[h] = highByte(args[i]);  h = ( h + 1 ) & mask;
+	}
+
+	head = h;
+}
+
+void EventLog::write( uint8_t event, uint8_t nArgs, const uint16_t * args )
+{
+	if ( nArgs > EventLog_MAX_ARGS )
+	{
+		nArgs = EventLog_MAX_ARGS;
+	}
+
+	unsigned long  now  = Clock::millis();
+	uint8_t        size = EventLog_HEADER_SIZE + 2 * nArgs;
+
+	// The record may be written from both the main loop and an interrupt
+	// handler, so the buffer must not change while this one is copied in.
+	uint8_t  oldSREG = SREG;
+	noInterrupts();
+
+	if ( dropped > 0 )
+	{
+		// Report the earlier losses first so the decoder sees them in order.
+		if ( space() < size + EventLog_HEADER_SIZE + 2 )
+		{
+			if ( dropped < 0xFFFF )
+			{
+				++dropped;
+			}
+			SREG = oldSREG;
+			return;
+		}
+
+		uint16_t  count = dropped;
+		put( LOG_DROPPED, (uint16_t) now, 1, &count );
+		dropped = 0;
+	}
+
+	if ( space() < size )
+	{
+		++dropped;
+		SREG = oldSREG;
+		return;
+	}
+
+	put( event, (uint16_t) now, nArgs, args );
+	lastWrite = now;
+
+	SREG = oldSREG;
+}
+
+void EventLog::service()
+{
+	unsigned long  now = Clock::millis();
+
+	uint8_t  oldSREG = SREG;
+	noInterrupts();
+	unsigned long  quiet = now - lastWrite;
+	SREG = oldSREG;
+
+	if ( quiet >= EventLog_TIME_INTERVAL )
+	{
+		log( LOG_TIME, (uint16_t) now, (uint16_t) ( now >> 16 ) );
+	}
+
+	// head can only move forward while this runs, so bytes between tail
+	// and the value read here are complete and safe to send.
+	while ( ( tail != head ) && ( Serial.availableForWrite() > 0 ) )
+	{
+		Serial.write( buffer[tail] );
+		tail = ( tail + 1 ) & ( EventLog_BUFFER_SIZE - 1 );
+	}
+}
+
+void EventLog::flush()
+{
+	while ( tail != head )
+	{
+		service();
+	}
+}
@@ -0,0 +1,193 @@
+/**
+ * Non-blocking event log that writes compact binary records to the serial
+ * port.
+ *
+ * Writing text with Serial.print() at 9600 baud takes about one millisecond
+ * per character once the serial transmit buffer is full, which is long
+ * enough to visibly stall a light show.  The EventLog class instead copies
+ * a small binary record into a RAM ring buffer and returns immediately.
+ * The records are moved to the serial port by service(), which only hands
+ * over as many bytes as the serial transmit buffer has room for.  The
+ * bytes are then sent by the UART transmit interrupt of the Arduino
+ * HardwareSerial driver, so neither side ever waits on the wire.
+ *
+ * service() is called from yield(), which the Arduino core calls while it
+ * waits inside delay().  Light shows therefore drain the log while they
+ * wait between frames without any extra code.
+ *
+ * If a record does not fit in the ring buffer it is dropped and counted.
+ * The count is written as a LOG_DROPPED record as soon as there is room.
+ *
+ * The record format is defined in EventLogFormat.h.  The program in
+ * extras/LogDecoder.cpp turns a capture of the serial stream back into
+ * readable text.
+ *
+ *  @date   Created on October 18, 2026
+ *  @author Steven F. LeBrun
+ *  <br/><br/>
+ */
+
+#ifndef EVENTLOG_H_
+#define EVENTLOG_H_
+
+#include <Arduino.h>
+
+#include "EventLogFormat.h"
+
+/**
+ * The size of the ring buffer in bytes.  Must be a power of two no larger
+ * than 256.  The default holds about eight typical records while keeping
+ * the RAM cost low on a 2 KB Arduino.
+ */
+#ifndef  EventLog_BUFFER_SIZE
+#define  EventLog_BUFFER_SIZE   64
+#endif
+
+/**
+ * The number of milliseconds the log can be quiet before service() writes
+ * a LOG_TIME record.  Must be less than the 65.536 second wrap of the
+ * 16 bit record timestamp.
+ */
+#define  EventLog_TIME_INTERVAL 30000UL
+
+/**
+ * The EventLog class only has static members.  There is a single serial
+ * port, so there is a single log, and static data avoids having to pass an
+ * instance to every light show.
+ */
+class EventLog
+{
+	private:
+		/**
+		 * The ring buffer holding the records waiting to be sent.
+		 */
+		static uint8_t  buffer[EventLog_BUFFER_SIZE];
+
+		/**
+		 * Offset in the buffer where the next byte will be written.  Only
+		 * changed by write(), with interrupts disabled.
+		 */
+		static volatile uint8_t  head;
+
+		/**
+		 * Offset in the buffer of the next byte to be sent.  Only changed
+		 * by service().
+		 */
+		static volatile uint8_t  tail;
+
+		/**
+		 * The number of records dropped since the last LOG_DROPPED record.
+		 */
+		static volatile uint16_t dropped;
+
+		/**
+		 * The millis() value when the last record was written.
+		 */
+		static volatile unsigned long lastWrite;
+
+		/**
+		 * Calculates the number of free bytes in the ring buffer.  One byte
+		 * is always kept free so that a full buffer can be told apart from
+		 * an empty one.
+		 *
+		 * @pre Interrupts must be disabled by the caller.
+		 */
+		static uint8_t space()
+		{
+			return (uint8_t) ( ( tail - head - 1 ) & ( EventLog_BUFFER_SIZE - 1 ) );
+		}
+
+		/**
+		 * Copies one record into the ring buffer.
+		 *
+		 * @pre Interrupts must be disabled and there must be room for the record.
+		 */
+		static void put( uint8_t event, uint16_t stamp, uint8_t nArgs, const uint16_t * args );
+
+	public:
+		/**
+		 * Adds a record to the log.  Safe to call from an interrupt handler.
+		 *
+		 * @param event  The event id, one of the LogEvent values.
+		 * @param nArgs  The number of arguments.  Values above EventLog_MAX_ARGS
+		 *               are truncated to EventLog_MAX_ARGS.
+		 * @param args   The arguments to store with the event.
+		 */
+		static void write( uint8_t event, uint8_t nArgs, const uint16_t * args );
+
+		/**
+		 * Adds a record without arguments to the log.
+		 *
+		 * @param event  The event id, one of the LogEvent values.
+		 */
+		static void log( uint8_t event )
+		{
+			write( event, 0, 0 );
+		}
+
+		/**
+		 * Adds a record with one argument to the log.
+		 *
+		 * @param event  The event id, one of the LogEvent values.
+		 * @param a0     The argument.
+		 */
+		static void log( uint8_t event, uint16_t a0 )
+		{
+			write( event, 1, &a0 );
+		}
+
+		/**
+		 * Adds a record with two arguments to the log.
+		 *
+		 * @param event  The event id, one of the LogEvent values.
+		 * @param a0     The first argument.
+		 * @param a1     The second argument.
+		 */
+		static void log( uint8_t event, uint16_t a0, uint16_t a1 )
+		{
+			uint16_t args[] = { a0, a1 };
+			write( event, 2, args );
+		}
+
+		/**
+		 * Adds a record with three arguments to the log.
+		 *
+		 * @param event  The event id, one of the LogEvent values.
+		 * @param a0     The first argument.
+		 * @param a1     The second argument.
+		 * @param a2     The third argument.
+		 */
+		static void log( uint8_t event, uint16_t a0, uint16_t a1, uint16_t a2 )
+		{
+			uint16_t args[] = { a0, a1, a2 };
+			write( event, 3, args );
+		}
+
+		/**
+		 * Moves as many bytes from the ring buffer to the serial port as the
+		 * serial transmit buffer can take without waiting.  Also writes a
+		 * LOG_TIME record if the log has been quiet for EventLog_TIME_INTERVAL.
+		 *
+		 * Must not be called from an interrupt handler.
+		 */
+		static void service();
+
+		/**
+		 * Waits until every queued record has been handed to the serial port.
+		 * Used when a burst of records larger than the ring buffer is written
+		 * on request, such as a counter report.  Not for use in light shows.
+		 *
+		 * Must not be called from an interrupt handler.
+		 */
+		static void flush();
+
+		/**
+		 * Provides access to the number of records dropped that have not yet
+		 * been reported in the log.
+		 *
+		 * @return Returns the number of records dropped.
+		 */
+		static uint16_t droppedRecords() { return dropped; };
+};
+
+#endif /* EVENTLOG_H_ */
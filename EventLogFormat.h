@@ -0,0 +1,146 @@
+/**
+ * Defines the binary record format written by the EventLog class and read
+ * back by the host side decoder, extras/LogDecoder.cpp.
+ *
+ * This header does not depend on the Arduino or FastLED libraries so that
+ * it can be included by programs built with a normal host compiler.
+ *
+ * Each record has the following layout.  Multi-byte values are stored
+ * least significant byte first.
+ *
+ *    Byte 0       EventLog_SYNC, marks the start of a record.
+ *    Byte 1       The event id, one of the LogEvent values.
+ *    Byte 2       The number of 16 bit arguments that follow the timestamp.
+ *    Bytes 3..4   The low 16 bits of millis() at the time the record was made.
+ *    Bytes 5..    The arguments, two bytes each.
+ *
+ * The timestamp wraps every 65.536 seconds.  The EventLog class writes a
+ * LOG_TIME record with the full millis() value whenever the log has been
+ * quiet for a while so that the decoder can keep track of absolute time.
+ *
+ *  @date   Created on October 18, 2026
+ *  @author Steven F. LeBrun
+ *  <br/><br/>
+ */
+
+#ifndef EVENTLOGFORMAT_H_
+#define EVENTLOGFORMAT_H_
+
+/**
+ * The value of the first byte of every record.  Used by the decoder to
+ * find the start of a record when it joins the stream part way through.
+ */
+#define  EventLog_SYNC         0xA5
+
+/**
+ * The number of bytes in a record before the first argument.
+ */
+#define  EventLog_HEADER_SIZE  5
+
+/**
+ * The largest number of arguments a single record can carry.
+ */
+#define  EventLog_MAX_ARGS     6
+
+/**
+ * The events that can be written to the log.  The comment for each event
+ * lists the arguments that are written with it.
+ *
+ * New events must be added to the end of the list so that old captures
+ * can still be decoded.  The decoder has its own table of names and must
+ * be updated when an event is added.
+ */
+enum LogEvent
+{
+	LOG_DROPPED     = 0,   ///< Records lost because the buffer was full: count.
+	LOG_TIME        = 1,   ///< Full millis() value: low word, high word.
+	LOG_BOOT        = 2,   ///< setup() has completed: no arguments.
+	LOG_MODE_CHANGE = 3,   ///< loop() has started a new mode: mode.
+	LOG_SHOW_START  = 4,   ///< A light show has started: ShowType, number of LEDs.
+	LOG_SPARKLE     = 5,   ///< One sparkle frame has been set: LEDs changed.
+	LOG_PERF_SHOW   = 6,   ///< Show counters: ShowType, frames (2 words), late frames, skipped frames, QualityLevel.
+	LOG_PERF_RENDER = 7,   ///< Show render time in us: ShowType, min, avg, max.
+	LOG_PERF_DEVICE = 8,   ///< Device counters: data pin, show() calls (2 words), setLED() calls (2 words), expected wire time in us.
+	LOG_PERF_OUTPUT = 9,   ///< Device show() time in us: data pin, min, avg, max.
+	LOG_BENCH       = 10,  ///< Benchmark result: BenchCase, LEDs, iterations (2 words), ns per call (2 words).
+	LOG_BENCH_CYCLES = 11, ///< Benchmark result: BenchCase, LEDs, iterations (2 words), cycles per call (2 words).
+	LOG_PERF_LAYER  = 12,  ///< Compositor blend time of one layer in us: layer, min, avg, max.
+	LOG_MODE_SWITCH = 13,  ///< First frame of a new mode shown: ShowType, us since loop() saw the change.
+	LOG_QUALITY     = 14,  ///< The frame governor changed level: ShowType, QualityLevel, average busy us, frame ms.
+	LOG_BUTTON      = 15,  ///< Mode button edge, while tracing: millis() (2 words), mode before the edge, 1 if accepted or 0 if a bounce.
+	LOG_PROGRAM     = 16,  ///< A light show program was received into EEPROM: bytes of code, or 0 if it was rejected.
+	LOG_MEMORY      = 17   ///< Free RAM between the heap and the stack in bytes: now, least since boot.
+};
+
+/**
+ * Identifies the kind of light show in records that refer to one.
+ */
+enum ShowType
+{
+	SHOW_UNKNOWN        = 0,
+	SHOW_FILL_AND_CLEAR = 1,
+	SHOW_SWEEPER        = 2,
+	SHOW_SPARKLE        = 3,
+	SHOW_COMPOSITOR     = 4,
+	SHOW_PALETTE        = 5,
+	SHOW_PARTICLES      = 6,
+	SHOW_SWEEPER_2D     = 7,
+	SHOW_SPATIAL        = 8,
+	SHOW_SWEEPER_SHADER = 9,
+	SHOW_FILL_SHADER    = 10,
+	SHOW_AUDIO          = 11,
+	SHOW_PROGRAM        = 12
+};
+
+/**
+ * The quality levels the frame governor of a light show steps through when
+ * rendering and showing a frame takes longer than the frame allows.  Each
+ * level keeps the savings of the levels before it.
+ */
+enum QualityLevel
+{
+	QUALITY_FULL         = 0,  ///< Everything, at the frame rate of the light show.
+	QUALITY_REDUCED      = 1,  ///< Fewer sparkles, no dithering or calibration, low priority devices at half rate.
+	QUALITY_HALF_RATE    = 2,  ///< Half the frame rate.
+	QUALITY_QUARTER_RATE = 3,  ///< A quarter of the frame rate.
+	QUALITY_LEVELS       = 4   ///< The number of levels, not a level.
+};
+
+/**
+ * Identifies the operation measured in benchmark records.  A benchmark
+ * record with only the BenchCase and LEDs arguments means there was not
+ * enough memory to run the benchmark at that number of LEDs.
+ */
+enum BenchCase
+{
+	BENCH_SET_LEDS      = 0,   ///< LedDevice::setLEDs().
+	BENCH_ADVANCE       = 1,   ///< LedDevice::advanceLEDs().
+	BENCH_RETREAT       = 2,   ///< LedDevice::retreatLEDs().
+	BENCH_SET_LED_LOOP  = 3,   ///< LedDevice::setLED() on every LED.
+	BENCH_SWEEPER       = 4,   ///< One frame of Sweeper.
+	BENCH_FILL_SOLID    = 5,   ///< One frame of FillSolid.
+	BENCH_SPARKLE       = 6,   ///< One frame of SparkleLEDs.
+	BENCH_NEXT_COLOR    = 7,   ///< Colors::nextColor().
+	BENCH_RANDOM_COLOR  = 8,   ///< Colors::randomJustColor().
+	BENCH_PALETTE_FILL  = 9,   ///< Colors::fillPalette() on every LED.
+	BENCH_HSV_LUT       = 10,  ///< Colors::hsvColor() on every LED.
+	BENCH_HSV_RAINBOW   = 11,  ///< FastLED hsv2rgb_rainbow() on every LED.
+	BENCH_HSV_SPECTRUM  = 12,  ///< FastLED hsv2rgb_spectrum() on every LED.
+	BENCH_PARTICLES     = 13,  ///< One frame of ParticleSparkle.
+	BENCH_FILL_STATIC   = 14,  ///< One frame of StaticFillSolid through frame().
+	BENCH_FILL_WRAPPED  = 15,  ///< One frame of StaticFillSolid through LightShow::nextFrame().
+	BENCH_COMMIT        = 16,  ///< LedDevice::commit() of a double buffered device.
+	BENCH_COMMIT_CALIBRATED = 17,  ///< LedDevice::commit() with a calibration table.
+	BENCH_XY_TABLE      = 18,  ///< XYMap::index() from a table on every cell of a square matrix.
+	BENCH_XY_COMPUTED   = 19,  ///< XYMap::compute() on every cell of a square matrix.
+	BENCH_SHADER_SWEEP  = 20,  ///< SweeperShader::prepare() and shade() on every LED.
+	BENCH_SHADER_FILL   = 21,  ///< FillSolidShader::prepare() and shade() on every LED.
+	BENCH_PROGRAM_SWEEP = 22,  ///< One frame of ProgramShow running ProgramShow::SWEEPER_PROGRAM.
+	BENCH_COMMIT_DIMMED = 23,  ///< LedDevice::commit() of a double buffered device at half brightness.
+	BENCH_RGBW_MIN      = 24,  ///< RgbwConverter::convert() on every LED with a pure white LED.
+	BENCH_RGBW_CALIBRATED = 25,  ///< RgbwConverter::convert() on every LED with a warm white LED.
+	BENCH_TWEENS        = 26,  ///< Animator::update() of 8, 64 or 256 tweens by one frame.
+	BENCH_CASES         = 27   ///< The number of benchmarks, not a benchmark.
+};
+
+#endif /* EVENTLOGFORMAT_H_ */
@@ -7,8 +7,10 @@
 
 #include "FillAndClear.h"
 
+const int FillAndClear::FILL_DELAY = FillAndClear_FILL_DELAY;
+
 FillAndClear::FillAndClear(LedDevice * dLED) :
-	LightShow(dLED)
+	LightShow(dLED, FILL_DELAY), step(0)
 {
 	maxLEDs = device->numberOfLEDs();
 }
@@ -17,25 +19,35 @@ FillAndClear::~FillAndClear()
 {
 }
 
-void FillAndClear::display()
- {
- 	Colors  colors;
+void FillAndClear::start()
+{
+	step = 0;
+}
 
-   //Serial.print("Entering FillAndClear::display()\n");
-   exitRun = false;
+void FillAndClear::resume()
+{
+	int  i;
 
-   int i;
-   int max = 2*maxLEDs;
+	for ( i = 0 ; i < maxLEDs ; ++i )
+	{
+		int  k = step - 1 - i;
 
-   for ( i = 0 ; i < max ; ++i )
-   {
-     device->advanceLEDs();
+		device->setLED( i, ( k >= 0 ) ? nextColor(k) : device->getBackground() );
+	}
+}
 
-     device->setLED(0, nextColor(i));
+bool FillAndClear::nextFrame()
+{
+	if ( step >= 2*maxLEDs )
+	{
+		return false;
+	}
+
+	device->advanceLEDs();
 
-     device->show();
-     delay(50);
+	device->setLED(0, nextColor(step));
 
-     CHECK_INTR;
-   }
- }
+	++step;
+
+	return true;
+}
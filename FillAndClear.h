@@ -14,12 +14,24 @@
 #include "Interrupts.h"
 #include "LightShow.h"
 
+/**
+ * The time, in milliseconds, each step of the fill and clear is shown.
+ */
+#define  FillAndClear_FILL_DELAY  50
+
 /**
  * Abstract base class for light shows that fill in the LED Device, one LED Unit
  * at a time then continues to clear them, one LED Unit at a time.
  */
 class  FillAndClear : public LightShow
 {
+	private:
+		/**
+		 * The amount of time, in milliseconds, to display each step of the
+		 * fill and clear before showing the next.
+		 */
+		static  const int FILL_DELAY;
+
 	protected:
 		/**
 		 * The number of LED Units in the LED Device.  This value is obtained
@@ -28,6 +40,12 @@ class  FillAndClear : public LightShow
 		 */
 		int  maxLEDs;
 
+		/**
+		 * The number of frames rendered since the light show started.  This
+		 * is the value passed to nextColor().  Legal range [0 .. 2*maxLEDs].
+		 */
+		int  step;
+
     public:
 		/**
 		 * Constructor.
@@ -65,11 +83,31 @@ class  FillAndClear : public LightShow
 		virtual CRGB nextColor( int led) = 0;
 
 		/**
-		 * The method that contains the code for the actual light show.  It will
-		 * advance the LED Unit color values and set the first LED Unit to the
-		 * color provided by the virtual method nextColor().
+		 * Restarts the fill from the first step.
+		 */
+		virtual void start();
+
+		/**
+		 * Repaints the LED Units for the current step.  Each step moves the
+		 * colors one LED Unit along, so LED Unit i holds the color given by
+		 * nextColor() i + 1 steps ago, or the background color if the fill
+		 * has not reached it yet.
+		 */
+		virtual void resume();
+
+		/**
+		 * Renders one step of the light show.  It will advance the LED Unit
+		 * color values and set the first LED Unit to the color provided by
+		 * the virtual method nextColor().
+		 *
+		 * @return Returns @b false once all 2*maxLEDs steps have been shown.
+		 */
+		virtual bool nextFrame();
+
+		/**
+		 * @return Returns SHOW_FILL_AND_CLEAR.
 		 */
-		virtual void display();
+		virtual uint8_t getShowType() { return SHOW_FILL_AND_CLEAR; };
 
  };   // end of class fillAndClear
 
@@ -0,0 +1,30 @@
+/*
+ * FillSolidShader.cpp
+ *
+ *  Created on: Oct 18, 2026
+ *      Author: Steven F. LeBrun
+ */
+
+#include "FillSolidShader.h"
+
+FillSolidShader::FillSolidShader( CRGB fColor, CRGB bColor, LedDevice * dLEDs ) :
+	PixelShader(dLEDs, FillAndClear_FILL_DELAY), step(0), foreground(fColor), background(bColor)
+{
+	maxLEDs = device->numberOfLEDs();
+}
+
+FillSolidShader::~FillSolidShader()
+{
+}
+
+bool FillSolidShader::prepare()
+{
+	if ( step >= 2 * maxLEDs )
+	{
+		return false;
+	}
+
+	++step;
+
+	return true;
+}
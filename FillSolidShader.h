@@ -0,0 +1,97 @@
+/**
+ * Pixel shader version of the FillSolid light show.
+ *
+ *  @date   Created on October 18, 2026
+ *  @author Steven F. LeBrun
+ *  <br/><br/>
+ */
+
+#ifndef FILLSOLIDSHADER_H_
+#define FILLSOLIDSHADER_H_
+
+#include "FillAndClear.h"
+#include "PixelShader.h"
+
+/**
+ * Fills the LED Device with the foreground color one LED unit per frame
+ * from the start, then empties it the same way, like FillSolid.  Only the
+ * frame number is kept; LED unit i is lit while it is behind the leading
+ * edge of the fill and ahead of the trailing edge.
+ */
+class FillSolidShader: public PixelShader
+{
+	protected:
+		/**
+		 * The number of frames shown since the light show started.
+		 */
+		int   step;
+
+		/**
+		 * The number of LED units of the LED Device.
+		 */
+		int   maxLEDs;
+
+		/**
+		 * The color of the fill.
+		 */
+		CRGB  foreground;
+
+		/**
+		 * The color of the LED units that are not filled.
+		 */
+		CRGB  background;
+
+	public:
+		/**
+		 * Constructor.
+		 *
+		 * @param fColor  The color of the fill.
+		 * @param bColor  The color of the LED units that are not filled.
+		 * @param dLEDs   Pointer to the LED Device to be used.
+		 */
+		FillSolidShader( CRGB fColor, CRGB bColor, LedDevice * dLEDs );
+
+		/**
+		 * Destructor.
+		 */
+		virtual ~FillSolidShader();
+
+		/**
+		 * Restarts the fill from the first LED unit.
+		 */
+		virtual void start() { step = 0; };
+
+		/**
+		 * Moves the fill one LED unit.
+		 *
+		 * @return Returns @b false once the LED Device has been filled and
+		 *         emptied.
+		 */
+		virtual bool prepare();
+
+		/**
+		 * @param index  The offset of the LED unit.
+		 * @return Returns the color of the LED unit for the current frame.
+		 */
+		virtual CRGB shade( int index )
+		{
+			return ( index < step && step - 1 - index < maxLEDs ) ? foreground : background;
+		}
+
+		/**
+		 * @return Returns SHOW_FILL_SHADER.
+		 */
+		virtual uint8_t getShowType() { return SHOW_FILL_SHADER; };
+
+		/**
+		 * @param fColor  The color of the fill.
+		 */
+		void setForeground( CRGB fColor ) { foreground = fColor; };
+
+		/**
+		 * @param bColor  The color of the LED units that are not filled.
+		 */
+		void setBackground( CRGB bColor ) { background = bColor; };
+};
+
+#endif /* FILLSOLIDSHADER_H_ */
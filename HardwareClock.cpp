@@ -0,0 +1,32 @@
+/*
+ * HardwareClock.cpp
+ *
+ *  Created on: Oct 18, 2026
+ *      Author: Steven F. LeBrun
+ */
+
+#include "HardwareClock.h"
+
+HardwareClock::~HardwareClock()
+{
+}
+
+unsigned long HardwareClock::readMillis()
+{
+	return ::millis();
+}
+
+unsigned long HardwareClock::readMicros()
+{
+	return ::micros();
+}
+
+void HardwareClock::wait( unsigned long ms )
+{
+	::delay( ms );
+}
+
+void HardwareClock::waitMicros( unsigned int us )
+{
+	::delayMicroseconds( us );
+}
@@ -0,0 +1,55 @@
+/**
+ * Class derived from Clock that reads the Arduino timer.
+ *
+ *  @date   Created on October 18, 2026
+ *  @author Steven F. LeBrun
+ *  <br/><br/>
+ */
+
+#ifndef HARDWARECLOCK_H_
+#define HARDWARECLOCK_H_
+
+#include "Clock.h"
+
+/**
+ * Class derived from Clock that passes every call on to the Arduino core.
+ * It is the clock the sketch uses unless another one is installed with
+ * Clock::use().
+ */
+class HardwareClock: public Clock
+{
+	public:
+		/**
+		 * Constructor.  Being constexpr lets the default clock be built by
+		 * the compiler, so it works for static objects that read the time
+		 * while they are constructed.
+		 */
+		constexpr HardwareClock() {};
+
+		/**
+		 * Destructor.
+		 */
+		virtual ~HardwareClock();
+
+		/**
+		 * @return Returns the Arduino millis().
+		 */
+		virtual unsigned long readMillis();
+
+		/**
+		 * @return Returns the Arduino micros().
+		 */
+		virtual unsigned long readMicros();
+
+		/**
+		 * Calls the Arduino delay(), which calls yield() while it waits.
+		 */
+		virtual void wait( unsigned long ms );
+
+		/**
+		 * Calls the Arduino delayMicroseconds().
+		 */
+		virtual void waitMicros( unsigned int us );
+};
+
+#endif /* HARDWARECLOCK_H_ */
@@ -3,17 +3,47 @@
  *     Author:  Steven F. LeBrun
  */
 
+#include <string.h>
+
 #include <FastLED.h>
 
+#include "Clock.h"
+#include "EventLog.h"
 #include "LedDevice.h"
 
+LedDevice * LedDevice::first = NULL;
+
 LedDevice::LedDevice(int nLEDs, int dPin, CRGB *lights) :
-	maxLEDs(nLEDs), dataPin(dPin), leds(lights), foreground(CRGB::Yellow), background(CRGB::Cyan)
+	maxLEDs(nLEDs), dataPin(dPin), segments(1), ledWireTime(LedDevice_WIRE_US_PER_LED), leds(lights), front(lights), retain(false),
+	nControllers(0), calibration(NULL), batches(NULL), map(NULL), coordinates(NULL),
+	quality(QUALITY_FULL), lowPriority(false), brightness(255), fadeFrom(255), fadeTarget(255),
+	fadeStart(0), fadeLength(0), fadeTime(0), level(255), foreground(CRGB::Yellow), background(CRGB::Cyan), setCalls(0),
+	changed(true), next(NULL)
 {
+	// Append to the list so reports come out in the order devices are declared.
+	LedDevice ** link = &first;
+
+	while ( *link != NULL )
+	{
+		link = &(*link)->next;
+	}
+
+	*link = this;
 }
 
 LedDevice::~LedDevice()
 {
+	LedDevice ** link = &first;
+
+	while ( *link != NULL && *link != this )
+	{
+		link = &(*link)->next;
+	}
+
+	if ( *link != NULL )
+	{
+		*link = next;
+	}
 }
 
 void LedDevice::advanceLEDs()
@@ -26,6 +56,7 @@ void LedDevice::advanceLEDs()
   }
 
   leds[0] = background;
+  changed = true;
 
 }
 
@@ -39,18 +70,302 @@ void LedDevice::retreatLEDs()
 	}
 
 	leds[maxLEDs - 1] = background;
+	changed = true;
+}
+
+void LedDevice::fillRect( uint8_t x, uint8_t y, uint8_t w, uint8_t h, CRGB color )
+{
+	uint8_t  right  = ( x + w > map->getWidth() )  ? map->getWidth()  : x + w;
+	uint8_t  bottom = ( y + h > map->getHeight() ) ? map->getHeight() : y + h;
+	uint8_t  i;
+	uint8_t  j;
+
+	for ( j = y ; j < bottom ; ++j )
+	{
+		for ( i = x ; i < right ; ++i )
+		{
+			leds[map->index( i, j )] = color;
+		}
+	}
+
+	changed = true;
+}
+
+void LedDevice::shiftLEDs( int8_t dx, int8_t dy )
+{
+	int  width  = map->getWidth();
+	int  height = map->getHeight();
+	int  x;
+	int  y;
+	int  row;
+	int  column;
+
+	// Walk away from the direction of travel so each color is read before
+	// it is overwritten.
+	for ( row = 0 ; row < height ; ++row )
+	{
+		y = ( dy > 0 ) ? height - 1 - row : row;
+
+		for ( column = 0 ; column < width ; ++column )
+		{
+			x = ( dx > 0 ) ? width - 1 - column : column;
+
+			int  fromX = x - dx;
+			int  fromY = y - dy;
+
+			if ( fromX >= 0 && fromX < width && fromY >= 0 && fromY < height )
+			{
+				leds[map->index( x, y )] = leds[map->index( fromX, fromY )];
+			}
+			else
+			{
+				leds[map->index( x, y )] = background;
+			}
+		}
+	}
+
+	changed = true;
+}
+
+void LedDevice::show()
+{
+	unsigned long  start  = Clock::micros();
+	bool           dimmed = false;
+	LedDevice *    d;
+	uint8_t        c;
+
+	// FastLED sends the controllers of every device, not just this one.  A
+	// device without a back buffer has nothing to scale into, so each of
+	// them must be sent at its own level or another device's show() would
+	// send it at full.
+	for ( d = first ; d != NULL ; d = d->next )
+	{
+		if ( d->front == d->leds && d->nControllers > 0 )
+		{
+			d->level = d->outputLevel();
+			dimmed  |= ( d->level < 255 );
+		}
+	}
+
+	if ( dimmed )
+	{
+		for ( d = first ; d != NULL ; d = d->next )
+		{
+			for ( c = 0 ; c < d->nControllers ; ++c )
+			{
+				d->controllers[c]->showLeds( ( d->front == d->leds ) ? d->level : 255 );
+			}
+		}
+	}
+	else
+	{
+		device.show();
+	}
+
+	showTime.record( Clock::micros() - start );
+}
+
+void LedDevice::addController( CLEDController & controller )
+{
+	if ( nControllers < LedDevice_MAX_CONTROLLERS )
+	{
+		controllers[nControllers++] = &controller;
+	}
+}
+
+void LedDevice::commit()
+{
+	level = outputLevel();
+
+	if ( front != leds && ( level < 255 || ( calibration != NULL && quality == QUALITY_FULL ) ) )
+	{
+		// The back buffer stays as the light show left it, so there is
+		// nothing to swap or retain.
+		if ( calibration != NULL && quality == QUALITY_FULL )
+		{
+			calibrate( level );
+		}
+		else
+		{
+			dim( level );
+		}
+
+		show();
+
+		// The front buffer is already scaled.
+		level = 255;
+		return;
+	}
+
+	if ( front != leds )
+	{
+		CRGB *  shown = front;
+		uint8_t c;
+
+		// Each controller keeps its offset into the device, which matters
+		// when the device is split across several data pins.
+		for ( c = 0 ; c < nControllers ; ++c )
+		{
+			controllers[c]->setLeds( leds + ( controllers[c]->leds() - front ), controllers[c]->size() );
+		}
+
+		front = leds;
+		leds  = shown;
+	}
+
+	show();
+
+	if ( retain && front != leds )
+	{
+		memcpy( leds, front, maxLEDs * sizeof(CRGB) );
+	}
+}
+
+void LedDevice::calibrate( uint8_t level )
+{
+	const CRGB *  in  = leds;
+	CRGB *        out = front;
+	int           i;
+
+	// Two LED units share each byte of the table.
+	for ( i = 0 ; i < maxLEDs ; i += 2, in += 2, out += 2 )
+	{
+		uint8_t       pair  = calibration[i >> 1];
+		const CRGB &  even  = batches[pair & 0x0F];
+
+		out[0].r = scale8( in[0].r, even.r );
+		out[0].g = scale8( in[0].g, even.g );
+		out[0].b = scale8( in[0].b, even.b );
+
+		if ( i + 1 < maxLEDs )
+		{
+			const CRGB &  odd = batches[pair >> 4];
+
+			out[1].r = scale8( in[1].r, odd.r );
+			out[1].g = scale8( in[1].g, odd.g );
+			out[1].b = scale8( in[1].b, odd.b );
+		}
+	}
+
+	if ( level < 255 )
+	{
+		nscale8_video( front, maxLEDs, level );
+	}
+}
+
+void LedDevice::dim( uint8_t level )
+{
+	memcpy( front, leds, maxLEDs * sizeof(CRGB) );
+	nscale8_video( front, maxLEDs, level );
+}
+
+void LedDevice::fade( uint8_t target, uint16_t ms )
+{
+	fadeFrom   = getFadeLevel();
+	fadeTarget = target;
+	fadeStart  = Clock::millis();
+	fadeLength = ms;
+}
+
+uint8_t LedDevice::getFadeLevel()
+{
+	unsigned long  elapsed;
+
+	if ( fadeLength == 0 )
+	{
+		return fadeTarget;
+	}
+
+	elapsed = Clock::millis() - fadeStart;
+
+	if ( elapsed >= fadeLength )
+	{
+		fadeLength = 0;
+		return fadeTarget;
+	}
+
+	return fadeFrom + (int16_t) ( ( (long) fadeTarget - fadeFrom ) * (long) elapsed / fadeLength );
+}
+
+uint8_t LedDevice::outputLevel()
+{
+	uint8_t  fadeLevel = getFadeLevel();
+
+	return ( fadeLevel == 255 ) ? brightness : scale8_video( brightness, fadeLevel );
+}
+
+void LedDevice::setCorrection( CRGB correction )
+{
+	uint8_t c;
+
+	for ( c = 0 ; c < nControllers ; ++c )
+	{
+		controllers[c]->setCorrection( correction );
+	}
+}
+
+void LedDevice::setCalibration( const uint8_t * table, const CRGB * batches )
+{
+	this->calibration = table;
+	this->batches     = batches;
+}
+
+void LedDevice::setQuality( uint8_t level )
+{
+	uint8_t c;
+
+	quality = level;
+
+	for ( c = 0 ; c < nControllers ; ++c )
+	{
+		controllers[c]->setDither( ( level == QUALITY_FULL ) ? BINARY_DITHER : DISABLE_DITHER );
+	}
+}
+
+void LedDevice::setBackBuffer( CRGB * buffer, bool retain )
+{
+	this->retain = retain;
+
+	if ( buffer == NULL )
+	{
+		// The controllers already point at the front buffer.
+		leds = front;
+		return;
+	}
+
+	memcpy( buffer, front, maxLEDs * sizeof(CRGB) );
+	leds = buffer;
 }
 
 void LedDevice::showBackground()
 {
 	setLEDsBackground();
-	device.show();
+	commit();
 }
 
 void LedDevice::showForeground()
 {
 	setLEDsForeground();
-	device.show();
+	commit();
+}
+
+void LedDevice::report()
+{
+	unsigned long  shows = showTime.getCount();
+	unsigned long  wire  = wireTime();
+	uint16_t       args[] = { (uint16_t) dataPin,
+	                          (uint16_t) shows,    (uint16_t) ( shows >> 16 ),
+	                          (uint16_t) setCalls, (uint16_t) ( setCalls >> 16 ),
+	                          (uint16_t) ( ( wire > 0xFFFFUL ) ? 0xFFFF : wire ) };
+
+	EventLog::write( LOG_PERF_DEVICE, 6, args );
+	showTime.log( LOG_PERF_OUTPUT, dataPin );
+}
+
+void LedDevice::resetCounters()
+{
+	showTime.reset();
+	setCalls = 0;
 }
 
 void LedDevice::setBackground( CRGB color )
@@ -77,10 +392,18 @@ void LedDevice::setLEDs(CRGB color)
 {
 	int i;
 
+	// A ShaderDevice has no color array.
+	if ( leds == NULL )
+	{
+		return;
+	}
+
 	for ( i = 0 ; i < maxLEDs ; ++i )
 	{
 		leds[i] = color;
 	}
+
+	changed = true;
 }
 
 
@@ -11,6 +11,40 @@
 
 #include "FastLED.h"
 
+#include "EventLogFormat.h"
+#include "TimingStats.h"
+#include "XYMap.h"
+
+/**
+ * The time, in microseconds, a WS2812B data line takes to send the colors
+ * of one LED unit: 24 bits at 1.25 microseconds per bit.
+ */
+#define  LedDevice_WIRE_US_PER_LED   30
+
+/**
+ * The time, in microseconds, the data line must be held low after the
+ * last LED unit so that the LED units latch the new colors.
+ */
+#define  LedDevice_WIRE_US_LATCH     50
+
+/**
+ * The largest number of FastLED controllers a device can be split across.
+ */
+#define  LedDevice_MAX_CONTROLLERS   4
+
+/**
+ * The number of coordinate units in a millimetre.  The position of each
+ * LED unit is kept in a signed 16 bit number, so positions can be given
+ * to within 1/16 mm up to about two metres either side of the origin.
+ */
+#define  LedDevice_UNITS_PER_MM      16
+
+/**
+ * The number of batch corrections a calibration table can refer to.  Each
+ * LED unit has a 4 bit batch number, so this cannot be more than 16.
+ */
+#define  LedDevice_MAX_BATCHES       16
+
 /**
  * The LedDevice base class defines the common functionality of a set of
  * addressable RGB LEDs.  This base class has only been tested with different
@@ -20,7 +54,8 @@
  * unit can be set to its own color.  An LED unit consists of multiple
  * LEDs and a controller chip.  For WS2812B or NeoPixel, the LED unit
  * contains red, green, and blue LEDs.  Some other types of LED units
- * include a fourth LED that is white.
+ * include a fourth LED that is white; the colors are still kept as RGB and
+ * turned into four channels as they are sent, @see LedRgbwStrip.
  *
  * The reason this is a base class instead the class to define all LED sets
  * is that it appears that the template used to create the CFastLED instance
@@ -52,10 +87,26 @@ class LedDevice
 		int       maxLEDs;
 
 		/**
-		 * The GPIO pin used to send data to the LED set.
+		 * The GPIO pin used to send data to the LED set.  For a device split
+		 * across several data pins, this is the pin of the first segment.
 		 */
 		int       dataPin;
 
+		/**
+		 * The number of data pins that send the LED units at the same time.
+		 * The LED units are divided evenly between the pins, in order.  Set
+		 * by the derived class only where the pins really are sent in
+		 * parallel; pins sent one after the other count as 1.  Defaults to 1.
+		 */
+		int       segments;
+
+		/**
+		 * The time, in microseconds, the data line takes to send the colors
+		 * of one LED unit.  Set by the derived class; defaults to
+		 * LedDevice_WIRE_US_PER_LED.
+		 */
+		uint8_t   ledWireTime;
+
 		/**
 		 * The array of colors, one element per LED unit in the set.
 		 *
@@ -63,9 +114,132 @@ class LedDevice
 		 *        variable.  This pointer provides easy access to
 		 *        the array so that colors for the individual LED unit
 		 *        can be set or read.
+		 *
+		 * When the device is double buffered this is the back buffer,
+		 * which light shows render into, and the device variable holds
+		 * the front buffer.  @see setBackBuffer()
 		 */
 		CRGB     *leds;
 
+		/**
+		 * The array of colors the FastLED controllers send to the LED units.
+		 * The same as leds unless the device is double buffered.
+		 */
+		CRGB     *front;
+
+		/**
+		 * Set to @b true when commit() copies the new front buffer into the
+		 * back buffer, for light shows that change the previous frame rather
+		 * than setting every LED unit.
+		 */
+		bool      retain;
+
+		/**
+		 * The FastLED controllers that send the colors of this device, one
+		 * for each call to addLeds() made by the derived class.  commit()
+		 * points them at the new front buffer.
+		 */
+		CLEDController * controllers[LedDevice_MAX_CONTROLLERS];
+
+		/**
+		 * The number of controllers in use.
+		 */
+		uint8_t   nControllers;
+
+		/**
+		 * The batch number of each LED unit, two to a byte with the even
+		 * LED unit in the low four bits, or NULL if the LED units are not
+		 * calibrated.  @see setCalibration()
+		 */
+		const uint8_t * calibration;
+
+		/**
+		 * The color correction of each batch, indexed by batch number.
+		 */
+		const CRGB *    batches;
+
+		/**
+		 * Maps the columns and rows of a matrix to the LED units, or NULL
+		 * if the device is not used as a matrix.  @see setMap()
+		 */
+		XYMap *   map;
+
+		/**
+		 * The x and y position of each LED unit in flash, in
+		 * 1/LedDevice_UNITS_PER_MM millimetres, or NULL if the positions
+		 * are not known.  @see setCoordinates()
+		 */
+		const int16_t * coordinates;
+
+		/**
+		 * The QualityLevel set by the light show running on this device.
+		 * At QUALITY_REDUCED and below dithering and calibration are skipped.
+		 */
+		uint8_t   quality;
+
+		/**
+		 * Set to @b true for a device whose light shows may drop to half
+		 * their frame rate first when frames run late.
+		 */
+		bool      lowPriority;
+
+		/**
+		 * The master brightness, out of 255.  @see setBrightness()
+		 */
+		uint8_t   brightness;
+
+		/**
+		 * The fade level when the current fade started.
+		 */
+		uint8_t   fadeFrom;
+
+		/**
+		 * The fade level at the end of the current fade.
+		 */
+		uint8_t   fadeTarget;
+
+		/**
+		 * The Clock::millis() value when the current fade started.
+		 */
+		unsigned long  fadeStart;
+
+		/**
+		 * The length, in milliseconds, of the current fade.  Zero once the
+		 * fade has reached fadeTarget.
+		 */
+		uint16_t  fadeLength;
+
+		/**
+		 * The time, in milliseconds, light shows take to fade in when they
+		 * start and out on a mode change.  @see setFadeTime()
+		 */
+		uint16_t  fadeTime;
+
+		/**
+		 * The output level of the frame being shown: the master brightness
+		 * scaled by the fade level.  Set by commit() and applied by show().
+		 * For a device without a back buffer the show() of any device sets
+		 * it again, since FastLED sends every device at once.
+		 */
+		uint8_t   level;
+
+		/**
+		 * Writes the colors of the back buffer, scaled by the correction of
+		 * the batch of each LED unit and then by the output level, into the
+		 * front buffer.
+		 *
+		 * @param level  The output level, out of 255.
+		 */
+		void calibrate( uint8_t level );
+
+		/**
+		 * Writes the colors of the back buffer, scaled by the output level
+		 * with video scaling, into the front buffer.
+		 *
+		 * @param level  The output level, out of 255.
+		 */
+		void dim( uint8_t level );
+
 		/**
 		 * Default Foreground color.
 		 *
@@ -82,6 +256,46 @@ class LedDevice
 	     */
 	    CRGB      background;
 
+	    /**
+	     * The time, in microseconds, taken by each call to show().
+	     *
+	     * On AVR the FastLED library turns interrupts off while it sends data
+	     * to the LED units, so timer overflows are missed and frames longer
+	     * than about a millisecond are under-reported by micros().
+	     */
+	    TimingStats   showTime;
+
+	    /**
+	     * The number of calls made to setLED().
+	     */
+	    unsigned long setCalls;
+
+	    /**
+	     * Set to @b true whenever the color array is changed through one of
+	     * the methods of this class.  Cleared by clearChanged().  Writes made
+	     * directly to the array returned by getLEDs() are not tracked.
+	     */
+	    bool          changed;
+
+	    /**
+	     * The first LED Device in the list of all LED Devices.  Used to report
+	     * the counters of every device.
+	     */
+	    static LedDevice * first;
+
+	    /**
+	     * The next LED Device in the list of all LED Devices.
+	     */
+	    LedDevice * next;
+
+	    /**
+	     * Records a controller created by the derived class with addLeds() so
+	     * that commit() can point it at the front buffer.
+	     *
+	     * @param controller  The value returned by addLeds().
+	     */
+	    void addController( CLEDController & controller );
+
 	public:
 	    /**
 	     * Constructor for the LedDevice base class.
@@ -96,11 +310,11 @@ class LedDevice
 		/**
 		 * Destructor for the LedDevice base class.
 		 *
-		 * This destructor does not explicitly do anything since the memory
-		 * referenced by the leds array is owned by the derived class.
-		 * This destructor is declared and defined so that base class pointers
-		 * will invoke the derived class destructors and the destructors of
-		 * the data members.
+		 * This destructor only removes the device from the list of all LED
+		 * Devices since the memory referenced by the leds array is owned by
+		 * the derived class.  This destructor is declared and defined so that
+		 * base class pointers will invoke the derived class destructors and
+		 * the destructors of the data members.
 		 */
 		virtual ~LedDevice();
 
@@ -129,7 +343,8 @@ class LedDevice
 		 * Provides access to the array of colors used to represent the settings
 		 * of each LED unit in the set.
 		 *
-		 * @return  Returns a pointer to the array of LED colors.
+		 * @return  Returns a pointer to the array of LED colors, or NULL
+		 *          for a ShaderDevice, which has none.
 		 */
 		CRGB * getLEDs()
 		{
@@ -147,20 +362,271 @@ class LedDevice
 		 */
 	    void setLED(int offset, CRGB color)
 	    {
+	    	++setCalls;
+	    	changed      = true;
 	    	leds[offset] = color;
 	    }
 
+	    /**
+	     * Sets the color of the LED unit at a column and row of the matrix.
+	     *
+	     * @pre A map must have been set with setMap().
+	     *
+	     * @param x      The column, [0..getMap()->getWidth()).
+	     * @param y      The row, [0..getMap()->getHeight()).
+	     * @param color  A Color as defined by the FastLED library.
+	     */
+	    void setXY( uint8_t x, uint8_t y, CRGB color )
+	    {
+	    	setLED( map->index( x, y ), color );
+	    }
+
 	    /**
 	     * Sends the current state of the LED color array to the LED units.
 	     *
 	     * This will cause the LED units to change color as defined by the
-	     * color array.
+	     * color array.  For a double buffered device this is the front
+	     * buffer; call commit() to show what was rendered.
+	     *
+	     * FastLED sends the LED units of every device at once, so while any
+	     * device without a back buffer is below full level each FastLED
+	     * controller of every device is sent at the level of its own
+	     * device.  @see outputLevel()
+	     */
+	    virtual void show();
+
+	    /**
+	     * Shows the frame that has been rendered.  For a double buffered
+	     * device the front and back buffers are swapped first, by swapping
+	     * pointers and pointing the controllers at the new front buffer, so
+	     * the frame is not copied.  Otherwise this is the same as show().
+	     *
+	     * The output level is worked out here, once per frame.  Below 255,
+	     * or with a calibration table, a double buffered device copies the
+	     * back buffer into the front buffer scaled instead of swapping.
+	     */
+	    void commit();
+
+	    /**
+	     * Turns double buffering on or off.  The current colors are copied
+	     * into the new back buffer so both buffers start with the same frame.
+	     *
+	     * @param buffer  An array with one element for each LED unit, used as
+	     *                the second buffer, or NULL to turn double buffering
+	     *                off.  The array must remain valid while in use.
+	     * @param retain  When @b true, commit() copies the frame it shows into
+	     *                the back buffer.  Needed by light shows that only
+	     *                change part of each frame, such as Sweeper, and by
+	     *                Compositor, which leaves the frame alone when no
+	     *                layer has changed.  Not needed by light shows that
+	     *                set every LED unit on every frame, such as
+	     *                PaletteShow.
+	     */
+	    void setBackBuffer( CRGB * buffer, bool retain = true );
+
+	    /**
+	     * Provides access to the colors being sent to the LED units.
+	     *
+	     * @return Returns the front buffer, the same as getLEDs() unless the
+	     *         device is double buffered.
+	     */
+	    CRGB * getFrontLEDs() { return front; };
+
+	    /**
+	     * Sets a color correction that the FastLED controllers apply to
+	     * every LED unit of this device as they send it, for example
+	     * TypicalLEDStrip.  The color array is not changed.
+	     *
+	     * @param correction  The scale, out of 255, of each color channel.
+	     */
+	    void setCorrection( CRGB correction );
+
+	    /**
+	     * Sets a correction for each LED unit, for a device made of LED units
+	     * from batches that show the same color differently.  Each LED unit
+	     * is given a batch number and each batch a color correction.
+	     *
+	     * The correction is applied by commit() as it fills the front buffer
+	     * from the back buffer, so light shows keep working with uncorrected
+	     * colors.  The device must be double buffered; without a back buffer
+	     * the calibration is ignored.  @see setBackBuffer()
+	     *
+	     * @param table    The batch number, [0..LedDevice_MAX_BATCHES), of
+	     *                 each LED unit, two to a byte with the even LED unit
+	     *                 in the low four bits.  (numberOfLEDs() + 1) / 2
+	     *                 bytes.  NULL turns the calibration off.
+	     * @param batches  The scale, out of 255, of each color channel for
+	     *                 each batch number used in the table.
+	     */
+	    void setCalibration( const uint8_t * table, const CRGB * batches );
+
+	    /**
+	     * Sets the quality level of the light show running on this device.
+	     * Below QUALITY_FULL the FastLED controllers stop dithering and
+	     * commit() does not apply the calibration table.
+	     *
+	     * @param level  One of the QualityLevel values.
+	     */
+	    void setQuality( uint8_t level );
+
+	    /**
+	     * @return Returns the QualityLevel set by the running light show.
+	     */
+	    uint8_t getQuality() { return quality; };
+
+	    /**
+	     * Sets the master brightness of the device.  It is applied on the way
+	     * out rather than to the color array, so light shows keep rendering
+	     * full colors and a new frame does not undo it.
+	     *
+	     * A double buffered device scales the back buffer into the front
+	     * buffer in commit() with video scaling, so an LED unit that is on
+	     * stays on however low the level.  ShaderDevice and LedRgbwStrip
+	     * scale each color the same way as they send it.  A device without a back buffer hands
+	     * the level to its FastLED controllers, which scale as they send at
+	     * no cost but can turn the dimmest colors off.  At 255 every device
+	     * shows its frames exactly as before.
+	     *
+	     * @param level  The brightness, out of 255.
+	     */
+	    void setBrightness( uint8_t level ) { brightness = level; };
+
+	    /**
+	     * @return Returns the master brightness set with setBrightness().
+	     */
+	    uint8_t getBrightness() { return brightness; };
+
+	    /**
+	     * Starts a fade of the device from its current fade level to a new
+	     * one.  The fade level scales the master brightness and moves in a
+	     * straight line over the time given, worked out once per frame.
+	     *
+	     * @param target  The fade level at the end of the fade, 0 for off and
+	     *                255 for the master brightness.
+	     * @param ms      The length of the fade in milliseconds, 0 to jump.
+	     */
+	    void fade( uint8_t target, uint16_t ms );
+
+	    /**
+	     * @return Returns the fade level now, out of 255.
+	     */
+	    uint8_t getFadeLevel();
+
+	    /**
+	     * @return Returns @b true until the current fade has reached its
+	     *         target.
+	     */
+	    bool isFading() { return getFadeLevel() != fadeTarget; };
+
+	    /**
+	     * @return Returns the level the next frame will be shown at: the
+	     *         master brightness scaled by the fade level.
+	     */
+	    uint8_t outputLevel();
+
+	    /**
+	     * Sets how long light shows on this device take to fade in when they
+	     * start and to fade out when the mode changes.  @see LightShow::display()
+	     *
+	     * @param ms  The time in milliseconds, 0 to cut from one light show
+	     *            to the next, which is the default.
+	     */
+	    void setFadeTime( uint16_t ms ) { fadeTime = ms; };
+
+	    /**
+	     * @return Returns the time set with setFadeTime().
+	     */
+	    uint16_t getFadeTime() { return fadeTime; };
+
+	    /**
+	     * Marks the device as low priority.  Light shows on a low priority
+	     * device drop to half their frame rate at QUALITY_REDUCED, before the
+	     * light shows of other devices do.
+	     *
+	     * @param low  @b true for a low priority device.
+	     */
+	    void setLowPriority( bool low ) { lowPriority = low; };
+
+	    /**
+	     * @return Returns @b true if the device is low priority.
+	     */
+	    bool isLowPriority() { return lowPriority; };
+
+	    /**
+	     * Provides access to the data pin, which also serves as the id of the
+	     * device in the event log.
+	     *
+	     * @return Returns the GPIO pin number used to send data to the device.
+	     */
+	    int getDataPin() { return dataPin; };
+
+	    /**
+	     * @return Returns the number of data pins that send the LED units at
+	     *         the same time.
 	     */
-	    void show()
+	    int getSegments() { return segments; };
+
+	    /**
+	     * Estimates how long the data lines are busy for one call to show(),
+	     * from the nominal time per LED unit and the latch time.  The
+	     * segments are sent at the same time, so this is the time for the
+	     * longest segment.  Used to compare the measured show() time against
+	     * what the wire allows, and by BufferDevice in place of a real wire.
+	     *
+	     * @return Returns the estimated wire time of one frame in microseconds.
+	     */
+	    unsigned long wireTime()
 	    {
-	    	device.show();
+	    	unsigned long  longest = ( maxLEDs + segments - 1 ) / segments;
+
+	    	return longest * ledWireTime + LedDevice_WIRE_US_LATCH;
 	    }
 
+	    /**
+	     * Writes the performance counters of this device to the EventLog as a
+	     * LOG_PERF_DEVICE and a LOG_PERF_OUTPUT record.
+	     */
+	    void report();
+
+	    /**
+	     * Sets the performance counters of this device back to zero.
+	     */
+	    void resetCounters();
+
+	    /**
+	     * Provides access to the list of all LED Devices.  The list is built
+	     * by the constructor in the order the devices are created.
+	     *
+	     * @return Returns the first LED Device in the list.
+	     */
+	    static LedDevice * firstDevice() { return first; };
+
+	    /**
+	     * @return Returns the LED Device after this one in the list of all
+	     *         LED Devices, or NULL if this is the last one.
+	     */
+	    LedDevice * nextDevice() { return next; };
+
+	    /**
+	     * Determines if the color array has been changed since the last call
+	     * to clearChanged().  Used by the Compositor to skip layers that are
+	     * the same as in the previous frame.
+	     *
+	     * @return Returns @b true if any LED unit has been set.
+	     */
+	    bool isChanged() { return changed; };
+
+	    /**
+	     * Marks the color array as unchanged.
+	     */
+	    void clearChanged() { changed = false; };
+
+	    /**
+	     * Marks the color array as changed.  Called by light shows that
+	     * write to the array returned by getLEDs() directly.
+	     */
+	    void setChanged() { changed = true; };
+
 
 	    /**
 	     * Move the color values of the LED units one position up the device.
@@ -176,6 +642,80 @@ class LedDevice
 	     */
 	    void retreatLEDs();
 
+	    /**
+	     * Lays a matrix over the LED units so that light shows can set them
+	     * by column and row.  The map must not have more cells than the
+	     * device has LED units.
+	     *
+	     * @param xyMap  The map, owned by the caller, or NULL to remove it.
+	     */
+	    void setMap( XYMap * xyMap ) { map = xyMap; };
+
+	    /**
+	     * @return Returns the map set with setMap(), or NULL if there is none.
+	     */
+	    XYMap * getMap() { return map; };
+
+	    /**
+	     * Gives the physical position of each LED unit so that light shows
+	     * can work across several devices in the same space.  All devices
+	     * share one set of axes: x to the right and y down, in
+	     * 1/LedDevice_UNITS_PER_MM millimetres.  Tables are made by
+	     * extras/CoordGen.cpp.
+	     *
+	     * @param table  Two entries, x then y, for each LED unit, stored in
+	     *               flash with PROGMEM.  NULL if the positions are not known.
+	     */
+	    void setCoordinates( const int16_t * table ) { coordinates = table; };
+
+	    /**
+	     * @return Returns @b true if the positions of the LED units are known.
+	     */
+	    bool hasCoordinates() { return coordinates != NULL; };
+
+	    /**
+	     * @pre The positions must have been set with setCoordinates().
+	     *
+	     * @param offset  The offset of the LED unit.
+	     * @return Returns the x position of the LED unit.
+	     */
+	    int16_t getX( int offset ) { return (int16_t) pgm_read_word( &coordinates[2 * offset] ); };
+
+	    /**
+	     * @pre The positions must have been set with setCoordinates().
+	     *
+	     * @param offset  The offset of the LED unit.
+	     * @return Returns the y position of the LED unit.
+	     */
+	    int16_t getY( int offset ) { return (int16_t) pgm_read_word( &coordinates[2 * offset + 1] ); };
+
+	    /**
+	     * Sets the LED units of a rectangle of the matrix to one color.  The
+	     * parts of the rectangle outside the matrix are ignored.
+	     *
+	     * @pre A map must have been set with setMap().
+	     *
+	     * @param x      The column of the left edge.
+	     * @param y      The row of the top edge.
+	     * @param w      The number of columns.
+	     * @param h      The number of rows.
+	     * @param color  A Color as defined by the FastLED library.
+	     */
+	    void fillRect( uint8_t x, uint8_t y, uint8_t w, uint8_t h, CRGB color );
+
+	    /**
+	     * Moves the colors of the matrix by a number of columns and rows, the
+	     * matrix version of advanceLEDs() and retreatLEDs().  Colors moved
+	     * off the matrix are lost and the cells left behind are set to the
+	     * background color.
+	     *
+	     * @pre A map must have been set with setMap().
+	     *
+	     * @param dx  The number of columns to move right, negative for left.
+	     * @param dy  The number of rows to move down, negative for up.
+	     */
+	    void shiftLEDs( int8_t dx, int8_t dy );
+
 	    /**
 	     * Displays the current background colors on all the LED units in the device.
 	     * This does not change the color values in the color array and the next
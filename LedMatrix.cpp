@@ -0,0 +1,23 @@
+/*
+ * LedMatrix.cpp
+ *
+ *  Created on: Oct 18, 2026
+ *      Author: Steven F. LeBrun
+ */
+
+#include "LedMatrix.h"
+
+LedMatrix::LedMatrix( uint8_t rotation ) :
+	LedDevice(LedMatrix_WIDTH * LedMatrix_HEIGHT, LedMatrix_DATA_PIN, matrix),
+	xyMap(LedMatrix_WIDTH, LedMatrix_HEIGHT, XY_SERPENTINE, rotation, XYMap::SERPENTINE_16x16)
+{
+	// NOTE: Must use a constant for the data pin in order for the template
+	//       to compile properly.
+	addController( device.addLeds<NEOPIXEL, LedMatrix_DATA_PIN>(leds, maxLEDs) );
+
+	setMap( &xyMap );
+}
+
+LedMatrix::~LedMatrix()
+{
+}
@@ -0,0 +1,75 @@
+/**
+ * Class derived from LedDevice to represent a 16 x 16 matrix of WS2812B LED
+ * units wired in serpentine rows that uses data pin 7 for communications.
+ *
+ *  @date   Created on October 18, 2026
+ *  @author Steven F. LeBrun
+ *  <br/><br/>
+ */
+
+#ifndef LEDMATRIX_H_
+#define LEDMATRIX_H_
+
+#include <FastLED.h>
+
+#include "LedDevice.h"
+#include "XYMap.h"
+
+/**
+ * Defines the number of columns of the matrix.
+ */
+#define  LedMatrix_WIDTH      16
+
+/**
+ * Defines the number of rows of the matrix.
+ */
+#define  LedMatrix_HEIGHT     16
+
+/**
+ * Defines the Arduino GPIO pin used for communications
+ * with the LED units.
+ */
+#define  LedMatrix_DATA_PIN    7
+
+/**
+ * Class derived from LedDevice to represent a 16 x 16 matrix of WS2812B LED
+ * units.  The first LED unit is in the top left corner and the rows run in
+ * a serpentine, so the device comes with an XYMap that reads the offsets
+ * from XYMap::SERPENTINE_16x16 and light shows can use the matrix methods
+ * of LedDevice straight away.
+ *
+ * The color array takes 768 bytes, so on an Arduino Uno the matrix does not
+ * fit alongside the strip and the ring.
+ */
+class LedMatrix: public LedDevice
+{
+	private:
+		/**
+		 * The array of colors for the device.  One element per LED unit.
+		 */
+		CRGB   matrix[LedMatrix_WIDTH * LedMatrix_HEIGHT];
+
+		/**
+		 * The map of the matrix.
+		 */
+		XYMap  xyMap;
+
+	public:
+		/**
+		 * Constructor.
+		 *
+		 * Creates the CFastLED instance for the device and invokes the
+		 * constructor of the parent class.
+		 *
+		 * @param rotation  One of the XYRotation values, for a matrix that is
+		 *                  mounted turned.
+		 */
+		LedMatrix( uint8_t rotation = XY_ROTATE_0 );
+
+		/**
+		 * Destructor.
+		 */
+		virtual ~LedMatrix();
+};
+
+#endif /* LEDMATRIX_H_ */
@@ -0,0 +1,39 @@
+/*
+ * LedParallelStrip.cpp
+ *
+ *  Created on: Oct 18, 2026
+ *      Author: Steven F. LeBrun
+ */
+
+#include "LedParallelStrip.h"
+
+const int   LedParallelStrip::STRIP_SIZE = LedParallelStrip_SEGMENTS * LedParallelStrip_SEGMENT_SIZE;
+
+LedParallelStrip::LedParallelStrip() :
+	LedDevice(STRIP_SIZE, LedParallelStrip_PIN_0, strip)
+{
+	// Only segments sent at the same time shorten the wire time.
+	segments = LedParallelStrip_PARALLEL ? LedParallelStrip_SEGMENTS : 1;
+
+	// NOTE: Must use constants for the data pins in order for the templates
+	//       to compile properly.
+#if defined(FASTLED_TEENSY4)
+	addController( device.addLeds<LedParallelStrip_SEGMENTS, WS2812B, LedParallelStrip_PIN_0, GRB>(leds, LedParallelStrip_SEGMENT_SIZE) );
+#else
+	addController( device.addLeds<NEOPIXEL, LedParallelStrip_PIN_0>(leds, LedParallelStrip_SEGMENT_SIZE) );
+#if LedParallelStrip_SEGMENTS > 1
+	addController( device.addLeds<NEOPIXEL, LedParallelStrip_PIN_1>(leds + LedParallelStrip_SEGMENT_SIZE, LedParallelStrip_SEGMENT_SIZE) );
+#endif
+#if LedParallelStrip_SEGMENTS > 2
+	addController( device.addLeds<NEOPIXEL, LedParallelStrip_PIN_2>(leds + 2 * LedParallelStrip_SEGMENT_SIZE, LedParallelStrip_SEGMENT_SIZE) );
+#endif
+#if LedParallelStrip_SEGMENTS > 3
+	addController( device.addLeds<NEOPIXEL, LedParallelStrip_PIN_3>(leds + 3 * LedParallelStrip_SEGMENT_SIZE, LedParallelStrip_SEGMENT_SIZE) );
+#endif
+#endif
+}
+
+LedParallelStrip::~LedParallelStrip()
+{
+
+}
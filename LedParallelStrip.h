@@ -0,0 +1,104 @@
+/**
+ * Class derived from LedDevice to represent one long strip of WS2812B LED
+ * units that is split into segments, each with its own data pin.
+ *
+ *  @date   Created on October 18, 2026
+ *  @author Steven F. LeBrun
+ *  <br/><br/>
+ */
+
+#ifndef LEDPARALLELSTRIP_H_
+#define LEDPARALLELSTRIP_H_
+
+#include <FastLED.h>
+
+#include "LedDevice.h"
+
+/**
+ * Defines the number of segments, and data pins, the strip is split into.
+ * Legal values are 1 to 4.
+ */
+#define  LedParallelStrip_SEGMENTS       2
+
+/**
+ * Defines the number of LED units in each segment.
+ */
+#define  LedParallelStrip_SEGMENT_SIZE   150
+
+/**
+ * Defines the Arduino GPIO pins used for communications with each segment.
+ * On a Teensy 4 only PIN_0 is used; the FastLED parallel driver takes the
+ * following segments from its own fixed list of pins after PIN_0.
+ */
+#define  LedParallelStrip_PIN_0    7    // NOTE: set to 1 on a Teensy 4.
+#define  LedParallelStrip_PIN_1    8
+#define  LedParallelStrip_PIN_2    9
+#define  LedParallelStrip_PIN_3   10
+
+/**
+ * Defined as 1 on platforms where FastLED sends all the segments at the
+ * same time, and as 0 where they are sent one after the other.
+ */
+#if defined(FASTLED_TEENSY4) || defined(ESP32)
+#define  LedParallelStrip_PARALLEL  1
+#else
+#define  LedParallelStrip_PARALLEL  0
+#endif
+
+/**
+ * Class derived from LedDevice to represent one long strip of WS2812B LED
+ * units that is split into segments, each with its own data pin.
+ *
+ * A single data line needs about 30 microseconds per LED unit, so the time
+ * to show a long strip limits its frame rate.  Splitting the strip lets
+ * each segment be sent at the same time as the others.  Light shows see a
+ * single LED Device with one array of colors; the split is only visible to
+ * the FastLED library.
+ *
+ * How the segments are sent depends on the platform:
+ *
+ *   - Teensy 4: a single FastLED parallel output controller drives all the
+ *     segments.
+ *   - ESP32: each segment has its own controller, and the FastLED RMT
+ *     driver sends all of them at the same time.
+ *   - AVR and others: each segment has its own controller and they are
+ *     sent one after the other.  The wiring is the same, so the strip can
+ *     move to a faster board without changes, but there is no speed up.
+ *     The device reports a single segment, so wireTime() is that of the
+ *     whole strip.
+ *
+ * The speed up can be measured on a host, @see extras/ParallelWire.cpp.
+ *
+ * Wire the segments so that the end of segment N is physically next to
+ * the start of segment N+1, or feed each segment from the middle outwards
+ * and reverse the offsets in the light show.
+ */
+class LedParallelStrip: public LedDevice
+{
+	private:
+		/**
+		 * The number of LED units in the device.
+		 */
+		static const int   STRIP_SIZE;
+
+		/**
+		 * The array of colors for the device.  One element per LED unit.
+		 */
+		CRGB  strip[LedParallelStrip_SEGMENTS * LedParallelStrip_SEGMENT_SIZE];
+
+	public:
+		/**
+		 * Constructor.
+		 *
+		 * Creates the CFastLED controllers for the segments and invokes the
+		 * constructor of the parent class.
+		 */
+		LedParallelStrip();
+
+		/**
+		 * Destuctor.
+		 */
+		virtual ~LedParallelStrip();
+};
+
+#endif /* LEDPARALLELSTRIP_H_ */
@@ -0,0 +1,47 @@
+/*
+ * LedRgbwStrip.cpp
+ *
+ *  Created on: Oct 18, 2026
+ *      Author: Steven F. LeBrun
+ */
+
+#include "Clock.h"
+#include "LedRgbwStrip.h"
+
+LedRgbwStrip::LedRgbwStrip() :
+	LedDevice(LedRgbwStrip_STRIP_SIZE, LedRgbwStrip_DATA_PIN, strip), wire(LedRgbwStrip_DATA_PIN)
+{
+	ledWireTime = LedRgbwStrip_WIRE_US_PER_LED;
+}
+
+LedRgbwStrip::~LedRgbwStrip()
+{
+}
+
+void LedRgbwStrip::show()
+{
+	unsigned long  start = Clock::micros();
+	RgbwPixel      pixel;
+	int            i;
+
+	// commit() has already dimmed the front buffer of a double buffered
+	// device, so only a device without a back buffer is scaled here.
+	for ( i = 0 ; i < maxLEDs ; ++i )
+	{
+		if ( level < 255 && front == leds )
+		{
+			converter.convert( CRGB( front[i] ).nscale8_video( level ), pixel );
+		}
+		else
+		{
+			converter.convert( front[i], pixel );
+		}
+
+		// An SK6812 RGBW takes green, red, blue and then white.
+		wire.send( pixel.g, pixel.r, pixel.b, pixel.w );
+	}
+
+	Clock::delayMicroseconds( LedRgbwStrip_LATCH_US );
+
+	showTime.record( Clock::micros() - start );
+}
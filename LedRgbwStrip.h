@@ -0,0 +1,100 @@
+/**
+ * Class derived from LedDevice to represent a strip of 60 SK6812 RGBW LED
+ * units that use data pin 9 for communications.
+ *
+ *  @date   Created on October 18, 2026
+ *  @author Steven F. LeBrun
+ *  <br/><br/>
+ */
+
+#ifndef LEDRGBWSTRIP_H_
+#define LEDRGBWSTRIP_H_
+
+#include "LedDevice.h"
+#include "NeoPixelWire.h"
+#include "RgbwConverter.h"
+
+/**
+ * Defines the number of LED units in the device.
+ */
+#define  LedRgbwStrip_STRIP_SIZE   60
+
+/**
+ * Defines the Arduino GPIO pin used for communications
+ * with the LED units.
+ */
+#define  LedRgbwStrip_DATA_PIN     9
+
+/**
+ * The time, in microseconds, the data line takes to send the four channels
+ * of one LED unit: 32 bits at 1.25 microseconds per bit.
+ */
+#define  LedRgbwStrip_WIRE_US_PER_LED  40
+
+/**
+ * The time, in microseconds, the data line is held low after the last LED
+ * unit so that the LED units latch the new colors.
+ */
+#define  LedRgbwStrip_LATCH_US     80
+
+/**
+ * Class derived from LedDevice to represent a strip of SK6812 LED units
+ * with red, green, blue and white LEDs.
+ *
+ * FastLED only sends three channels, so like ShaderDevice this class
+ * drives the data line itself, one LED unit at a time.  The color array is
+ * the usual array of CRGB, so every light show runs on it unchanged, and
+ * each color is turned into four channels by an RgbwConverter just before
+ * it is sent.  Keeping the colors as RGB takes three bytes per LED unit
+ * where an array of RGBW colors would take four; the price is converting
+ * every LED unit on every frame, @see BENCH_RGBW_MIN and
+ * BENCH_RGBW_CALIBRATED.
+ *
+ * The FastLED color correction, setCorrection(), does not apply.  Double
+ * buffering, calibration and brightness do.
+ */
+class LedRgbwStrip: public LedDevice
+{
+	private:
+		/**
+		 * The array of colors for the device.  One element per LED unit.
+		 */
+		CRGB           strip[LedRgbwStrip_STRIP_SIZE];
+
+		/**
+		 * The data line.
+		 */
+		NeoPixelWire   wire;
+
+		/**
+		 * Turns each color into the four channels sent.
+		 */
+		RgbwConverter  converter;
+
+	public:
+		/**
+		 * Constructor.
+		 */
+		LedRgbwStrip();
+
+		/**
+		 * Destructor.
+		 */
+		virtual ~LedRgbwStrip();
+
+		/**
+		 * Sets the color of the white LEDs, @see RgbwConverter::setWhite().
+		 * By default they are taken to be pure white.
+		 *
+		 * @param color  The color the white LED shows at full.
+		 */
+		void setWhite( CRGB color ) { converter.setWhite( color ); };
+
+		/**
+		 * Converts and sends the color of every LED unit, then holds the
+		 * data line low so the LED units latch the colors.
+		 */
+		virtual void show();
+};
+
+#endif /* LEDRGBWSTRIP_H_ */
@@ -9,12 +9,31 @@
 
 const int   LedRing::RING_SIZE = LedRing_RING_SIZE;
 
+// Generated by extras/CoordGen.cpp.
+const int16_t LedRing::COORDINATES[] PROGMEM =
+{
+	  8000,   1352,
+	  8124,   1385,
+	  8215,   1476,
+	  8248,   1600,
+	  8215,   1724,
+	  8124,   1815,
+	  8000,   1848,
+	  7876,   1815,
+	  7785,   1724,
+	  7752,   1600,
+	  7785,   1476,
+	  7876,   1385
+};
+
 LedRing::LedRing() :
 	LedDevice(RING_SIZE, LedRing_DATA_PIN, ring)
 {
 	// NOTE: Must use a constant for the data pin in order for the template
 	//       to compile properly.
-	device.addLeds<NEOPIXEL, LedRing_DATA_PIN>(leds, maxLEDs);
+	addController( device.addLeds<NEOPIXEL, LedRing_DATA_PIN>(leds, maxLEDs) );
+
+	setCoordinates( COORDINATES );
 }
 
 LedRing::~LedRing()
@@ -54,6 +54,13 @@ class LedRing: public LedDevice
 		CRGB  ring[LedRing_RING_SIZE];
 
 	public:
+		/**
+		 * The position of each LED unit, as for LedDevice::setCoordinates().
+		 * The ring is 31 mm across, with its centre 500 mm along and 100 mm
+		 * below the first LED unit of the strip, and LED unit 0 at the top.
+		 */
+		static const int16_t  COORDINATES[];
+
 		/**
 		 * Constructor.
 		 *
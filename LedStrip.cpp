@@ -9,10 +9,77 @@
 
 const int   LedStrip::STRIP_SIZE = LedStrip_STRIP_SIZE;
 
+// Generated by extras/CoordGen.cpp.
+const int16_t LedStrip::COORDINATES[] PROGMEM =
+{
+	     0,      0,
+	   267,      0,
+	   533,      0,
+	   800,      0,
+	  1067,      0,
+	  1333,      0,
+	  1600,      0,
+	  1867,      0,
+	  2133,      0,
+	  2400,      0,
+	  2667,      0,
+	  2933,      0,
+	  3200,      0,
+	  3467,      0,
+	  3733,      0,
+	  4000,      0,
+	  4267,      0,
+	  4533,      0,
+	  4800,      0,
+	  5067,      0,
+	  5333,      0,
+	  5600,      0,
+	  5867,      0,
+	  6133,      0,
+	  6400,      0,
+	  6667,      0,
+	  6933,      0,
+	  7200,      0,
+	  7467,      0,
+	  7733,      0,
+	  8000,      0,
+	  8267,      0,
+	  8534,      0,
+	  8800,      0,
+	  9067,      0,
+	  9334,      0,
+	  9600,      0,
+	  9867,      0,
+	 10134,      0,
+	 10400,      0,
+	 10667,      0,
+	 10934,      0,
+	 11200,      0,
+	 11467,      0,
+	 11734,      0,
+	 12000,      0,
+	 12267,      0,
+	 12534,      0,
+	 12800,      0,
+	 13067,      0,
+	 13334,      0,
+	 13600,      0,
+	 13867,      0,
+	 14134,      0,
+	 14400,      0,
+	 14667,      0,
+	 14934,      0,
+	 15200,      0,
+	 15467,      0,
+	 15734,      0
+};
+
 LedStrip::LedStrip() :
 	LedDevice(STRIP_SIZE, LedStrip_DATA_PIN, strip)
 {
-	device.addLeds<NEOPIXEL, LedStrip_DATA_PIN>(leds, maxLEDs);
+	addController( device.addLeds<NEOPIXEL, LedStrip_DATA_PIN>(leds, maxLEDs) );
+
+	setCoordinates( COORDINATES );
 }
 
 LedStrip::~LedStrip()
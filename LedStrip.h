@@ -48,6 +48,13 @@ class LedStrip: public LedDevice
 		CRGB  strip[LedStrip_STRIP_SIZE];
 
 	public:
+		/**
+		 * The position of each LED unit, as for LedDevice::setCoordinates().
+		 * The strip has 60 LED units per metre and runs to the right from
+		 * the origin.
+		 */
+		static const int16_t  COORDINATES[];
+
 		/**
 		 * Constructor.
 		 *
@@ -5,16 +5,235 @@
  *      Author: Steven F. LeBrun
  */
 
+#include "Clock.h"
+#include "EventLog.h"
 #include "LightShow.h"
 
-LightShow::LightShow( LedDevice * dLEDs ) :
-	device(dLEDs)
+LightShow *    LightShow::current       = NULL;
+bool           LightShow::switchPending = false;
+unsigned long  LightShow::switchStart   = 0;
+
+LightShow::LightShow( LedDevice * dLEDs, unsigned long fDelay ) :
+	device(dLEDs), frameDelay(fDelay)
 {
 
 }
 
 LightShow::~LightShow()
 {
+	// A light show built by a mode can go out of scope without run()
+	// returning, as when a host replay ends inside it.
+	if ( current == this )
+	{
+		current = NULL;
+	}
+}
+
+void LightShow::display()
+{
+	unsigned long  frameStart;
+	unsigned long  renderStart;
+	unsigned long  elapsed;
+	unsigned long  period;
+	bool           fadingOut = false;
+
+	exitRun = false;
+
+	EventLog::log( LOG_SHOW_START, getShowType(), numberOfLEDs() );
+
+	if ( suspended )
+	{
+		resume();
+	}
+	else
+	{
+		start();
+	}
+
+	suspended = false;
+
+	// The device may have been used by a light show at another level.
+	device->setQuality( quality );
+	busyTotal   = 0;
+	busyFrames  = 0;
+	calmWindows = 0;
+
+	// Fade in from off after a mode switch.  Running the same mode again
+	// starts at full.  @see LedDevice::setFadeTime()
+	if ( switchPending )
+	{
+		fadeDevices( 0, true );
+		fadeDevices( 255 );
+	}
+
+	frameStart = Clock::millis();
+
+	for ( ; ; )
+	{
+		renderStart = Clock::micros();
+
+		if ( ! nextFrame() )
+		{
+			break;
+		}
+
+		renderTime.record( Clock::micros() - renderStart );
+
+		commitFrame();
+
+		busyTotal += Clock::micros() - renderStart;
+
+		if ( switchPending )
+		{
+			unsigned long  latency = Clock::micros() - switchStart;
+
+			switchPending = false;
+			EventLog::log( LOG_MODE_SWITCH, getShowType(),
+			               ( latency > 0xFFFFUL ) ? 0xFFFF : (uint16_t) latency );
+		}
+
+		// Wait out the rest of the frame.  A late frame starts the next one
+		// immediately rather than trying to catch up.
+		elapsed = Clock::millis() - frameStart;
+		period  = framePeriod( quality );
+
+		if ( elapsed <= period )
+		{
+			Clock::delay( period - elapsed );
+			frameStart += period;
+		}
+		else
+		{
+			if ( period > 0 )
+			{
+				++lateFrames;
+				skippedFrames += ( elapsed / period ) - 1;
+			}
+			frameStart = Clock::millis();
+		}
+
+		if ( ++busyFrames >= LightShow_GOVERNOR_FRAMES )
+		{
+			govern();
+		}
+
+		if ( mode_change )
+		{
+			// Keep the light show running while the devices fade out.
+			if ( ! fadingOut )
+			{
+				fadingOut = true;
+				fadeDevices( 0 );
+			}
+
+			if ( isFading() )
+			{
+				continue;
+			}
+
+			suspended = true;
+			suspend();
+			exitRun = true;
+			break;
+		}
+	}
+
+	// Back to full for modes that use the devices directly, however the
+	// light show ended.  The next light show fades in from off again.
+	if ( fadingOut )
+	{
+		fadeDevices( 255, true );
+	}
+}
+
+unsigned long LightShow::framePeriod( uint8_t level )
+{
+	uint8_t  shift = 0;
+
+	if ( level >= QUALITY_HALF_RATE )
+	{
+		shift = level - QUALITY_REDUCED;
+	}
 
+	// Light shows on a low priority device drop their frame rate one level early.
+	if ( level > QUALITY_FULL && device->isLowPriority() )
+	{
+		++shift;
+	}
+
+	return frameDelay << shift;
 }
 
+void LightShow::setQuality( uint8_t level )
+{
+	quality = level;
+	device->setQuality( level );
+}
+
+void LightShow::govern()
+{
+	unsigned long  busy   = busyTotal / busyFrames;
+	unsigned long  period = framePeriod( quality );
+
+	busyTotal  = 0;
+	busyFrames = 0;
+
+	if ( ! governed || period == 0 )
+	{
+		return;
+	}
+
+	// The busy time is in microseconds and the frame time in milliseconds,
+	// so the percentages are scaled by 1000 / 100.
+	if ( busy > period * 10UL * LightShow_BUSY_HIGH )
+	{
+		calmWindows = 0;
+
+		if ( quality + 1 >= QUALITY_LEVELS )
+		{
+			return;
+		}
+
+		setQuality( quality + 1 );
+	}
+	else if ( quality > QUALITY_FULL
+	          && busy < framePeriod( quality - 1 ) * 10UL * LightShow_BUSY_LOW )
+	{
+		if ( ++calmWindows < LightShow_GOVERNOR_CALM )
+		{
+			return;
+		}
+
+		calmWindows = 0;
+		setQuality( quality - 1 );
+	}
+	else
+	{
+		calmWindows = 0;
+		return;
+	}
+
+	uint16_t  args[] = { getShowType(), quality,
+	                     ( busy > 0xFFFFUL ) ? (uint16_t) 0xFFFF : (uint16_t) busy,
+	                     (uint16_t) framePeriod( quality ) };
+
+	EventLog::write( LOG_QUALITY, 4, args );
+}
+
+void LightShow::report()
+{
+	unsigned long  frames = renderTime.getCount();
+	uint16_t       args[] = { getShowType(),
+	                          (uint16_t) frames, (uint16_t) ( frames >> 16 ),
+	                          (uint16_t) lateFrames, (uint16_t) skippedFrames, quality };
+
+	EventLog::write( LOG_PERF_SHOW, 6, args );
+	renderTime.log( LOG_PERF_RENDER, getShowType() );
+}
+
+void LightShow::resetCounters()
+{
+	renderTime.reset();
+	lateFrames    = 0;
+	skippedFrames = 0;
+}
@@ -10,8 +10,11 @@
 
 #include <FastLED.h>
 
+#include "Clock.h"
+#include "EventLogFormat.h"
 #include "Interrupts.h"
 #include "LedDevice.h"
+#include "TimingStats.h"
 
 /**
  * Macro function that determines if the Interrupt method has run
@@ -27,10 +30,47 @@
  */
 #define  CHECK_EXIT  if ( exitRun ) { return; }
 
+/**
+ * The number of frames the frame governor averages the busy time over
+ * before it decides whether to change the quality level.
+ */
+#define  LightShow_GOVERNOR_FRAMES   8
+
+/**
+ * The frame governor lowers the quality level when rendering and showing
+ * take more than this percentage of the frame time.
+ */
+#define  LightShow_BUSY_HIGH        90
+
+/**
+ * The frame governor raises the quality level when rendering and showing
+ * would take less than this percentage of the frame time of the level above.
+ */
+#define  LightShow_BUSY_LOW         70
+
+/**
+ * The number of quiet averaging windows in a row needed before the frame
+ * governor raises the quality level.  Keeps it from stepping back and forth.
+ */
+#define  LightShow_GOVERNOR_CALM     4
+
 /**
  * Abstract Base Class that is used for running a "light show" on an
  * LED Device.  The derived classes provide the code for the actual
  * control of the LED units in the LED Device.
+ *
+ * A light show is made up of frames.  The derived class sets the LED
+ * units for one frame at a time in nextFrame() and this class sends each
+ * frame to the LED Device and waits until it is time for the next one.
+ * Keeping the timing in one place allows the time taken to render and to
+ * show each frame to be measured for every light show.
+ *
+ * The measured times also drive a frame governor.  When rendering and
+ * showing take more than LightShow_BUSY_HIGH percent of the frame time the
+ * governor steps down one QualityLevel: first the light show and the LED
+ * Device reduce their detail, then the frame rate is halved and halved
+ * again, keeping the frames evenly spaced.  It steps back up once the
+ * frames fit easily again.
  */
 class LightShow
 {
@@ -49,13 +89,90 @@ class LightShow
      */
     LedDevice * device;
 
+    /**
+     * The amount of time, in milliseconds, from the start of one frame
+     * to the start of the next.
+     */
+    unsigned long  frameDelay;
+
+    /**
+     * The time, in microseconds, taken by nextFrame() to set the LED units
+     * for each frame.  The count of this object is the number of frames
+     * rendered.
+     */
+    TimingStats    renderTime;
+
+    /**
+     * The number of frames that took longer than frameDelay to render and show.
+     */
+    unsigned long  lateFrames  = 0;
+
+    /**
+     * The number of whole frame periods that passed without a frame because
+     * an earlier frame ran late.
+     */
+    unsigned long  skippedFrames = 0;
+
+    /**
+     * Set to @b true when display() exits because of a mode change before
+     * the light show has finished.  The next call to display() calls
+     * resume() instead of start().
+     */
+    bool           suspended = false;
+
+    /**
+     * The current QualityLevel.  Derived classes that can render with less
+     * detail check this in nextFrame().
+     */
+    uint8_t        quality = QUALITY_FULL;
+
+    /**
+     * Set to @b false to keep the light show at its current quality level.
+     */
+    bool           governed = true;
+
+    /**
+     * The time, in microseconds, spent rendering and showing the frames of
+     * the current governor window.
+     */
+    unsigned long  busyTotal = 0;
+
+    /**
+     * The number of frames in the current governor window.
+     */
+    uint8_t        busyFrames = 0;
+
+    /**
+     * The number of quiet governor windows in a row.
+     */
+    uint8_t        calmWindows = 0;
+
+    /**
+     * The light show that is currently running, or NULL if none is.  Used to
+     * report the counters of the running show on request.
+     */
+    static LightShow * current;
+
+    /**
+     * Set to @b true by markSwitch() and cleared when the next light show
+     * has shown its first frame.
+     */
+    static bool           switchPending;
+
+    /**
+     * The micros() value when markSwitch() was called.
+     */
+    static unsigned long  switchStart;
+
   public:
     /**
      * Constructor.
      *
-     * @param dLEDs A pointer to the LED Device that this instance works on.
+     * @param dLEDs  A pointer to the LED Device that this instance works on.
+     * @param fDelay The time, in milliseconds, from the start of one frame
+     *               to the start of the next.
      */
-    LightShow( LedDevice * dLEDs );
+    LightShow( LedDevice * dLEDs, unsigned long fDelay = 50 );
 
     /**
      * Destructor.
@@ -66,12 +183,152 @@ class LightShow
     virtual ~LightShow();
 
     /**
-     * This virtual method is supplied by the derived class.  It is used to
-     * perform the actual light show.  It may be a single pass method or
-     * contain an infinite loop.  If it contains an infinite loop, the loop
-     * should terminate when an interrupt occurs to change mode.
+     * Prepares the light show to render its first frame.  Called by display()
+     * each time the light show is started.  The default does nothing.
+     */
+    virtual void start() { };
+
+    /**
+     * Called by display() when it exits because of a mode change.  The light
+     * show keeps its state so that it can continue where it left off the
+     * next time it is run.  The default does nothing.
+     */
+    virtual void suspend() { };
+
+    /**
+     * Called by display() instead of start() when the light show was
+     * suspended.  Other light shows may have used the LED Device in the
+     * meantime, so this repaints the LED units from the saved state.  The
+     * default does nothing, which suits light shows that set every LED unit
+     * on every frame.
+     */
+    virtual void resume() { };
+
+    /**
+     * Makes the next run start the light show from the beginning rather than
+     * resume it.
+     */
+    void reset() { suspended = false; };
+
+    /**
+     * @return Returns @b true if the next run will resume the light show
+     *         rather than start it from the beginning.
+     */
+    bool isSuspended() { return suspended; };
+
+    /**
+     * Marks the start of a mode switch.  The time from this call until the
+     * next light show has shown its first frame is written to the event log
+     * as a LOG_MODE_SWITCH record.
+     */
+    static void markSwitch()
+    {
+    	switchStart   = Clock::micros();
+    	switchPending = true;
+    }
+
+    /**
+     * This virtual method is supplied by the derived class.  It sets the
+     * LED units of the LED Device for the next frame of the light show.  It
+     * must not call show() or commit() on the LED Device or wait; display()
+     * does both.
+     *
+     * @return Returns @b true if a frame was rendered and @b false if the
+     *         light show has finished.  Light shows that run forever never
+     *         return @b false.
+     */
+    virtual bool nextFrame() = 0;
+
+    /**
+     * Identifies the kind of light show in the event log.
+     *
+     * @return Returns one of the ShowType values.
+     */
+    virtual uint8_t getShowType() { return SHOW_UNKNOWN; };
+
+    /**
+     * Performs the light show.  Calls start(), or resume() if the light show
+     * was suspended, and then renders, shows and times frames until
+     * nextFrame() returns @b false or an interrupt occurs to change mode.
+     *
+     * If the LED Device has a fade time the light show fades in from off
+     * when it is the first to run after markSwitch(), and after a mode
+     * change keeps rendering frames until it has faded out.  A fade out is
+     * ended at full level however display() exits, nextFrame() returning
+     * @b false included, so a mode that uses the devices directly is not
+     * left dark.  @see LedDevice::setFadeTime()
+     *
+     * Derived classes may override this method to take full control of
+     * the light show.
+     */
+    virtual void display( );
+
+    /**
+     * Writes the performance counters of this light show to the EventLog
+     * as a LOG_PERF_SHOW and a LOG_PERF_RENDER record.  Derived classes
+     * that keep extra counters add their own records after these.
+     */
+    virtual void report();
+
+    /**
+     * Sets the performance counters of this light show back to zero.
+     */
+    virtual void resetCounters();
+
+    /**
+     * Provides access to the light show that is currently running.
+     *
+     * @return Returns the running light show, or NULL if none is running.
+     */
+    static LightShow * running() { return current; };
+
+    /**
+     * Changes the time from the start of one frame to the start of the next.
+     *
+     * @param fDelay  The new frame time in milliseconds.
+     */
+    void setFrameDelay( unsigned long fDelay ) { frameDelay = fDelay; };
+
+    /**
+     * @return Returns the time from the start of one frame to the start of
+     *         the next in milliseconds.
+     */
+    unsigned long getFrameDelay() { return frameDelay; };
+
+    /**
+     * Calculates the time between frames at a quality level.
+     *
+     * @param level  One of the QualityLevel values.
+     * @return Returns the frame time in milliseconds.
      */
-    virtual void display( ) = 0;
+    unsigned long framePeriod( uint8_t level );
+
+    /**
+     * Changes the quality level of the light show and of its LED Device.
+     * Called by the frame governor.  Derived classes that run other light
+     * shows pass the level on to them.
+     *
+     * @param level  One of the QualityLevel values.
+     */
+    virtual void setQuality( uint8_t level );
+
+    /**
+     * @return Returns the current QualityLevel.
+     */
+    uint8_t getQuality() { return quality; };
+
+    /**
+     * Turns the frame governor on or off.  It is on by default.  Turning
+     * it off leaves the light show at its current quality level.
+     *
+     * @param on  @b true to let the governor change the quality level.
+     */
+    void setGovernor( bool on ) { governed = on; };
+
+    /**
+     * @return Returns the LED Device that this light show runs on.
+     */
+    LedDevice * getLedDevice() { return device; };
 
     /**
      * Provides access to the interrupt state.  It is used to determine if the
@@ -82,6 +339,47 @@ class LightShow
      */
     bool stopNow() { return exitRun; };
 
+  protected:
+    /**
+     * Sends the frame rendered by nextFrame() to the LED units.  Called by
+     * display() after each frame.  The default commits the LED Device of
+     * the light show; light shows that render onto several devices commit
+     * each of them, @see MultiDeviceShow.
+     */
+    virtual void commitFrame() { device->commit(); };
+
+    /**
+     * @return Returns the number of LED units the light show renders, for
+     *         the LOG_SHOW_START record.
+     */
+    virtual int numberOfLEDs() { return device->numberOfLEDs(); };
+
+    /**
+     * Starts a fade of the LED Device over its fade time.  Light shows that
+     * render onto several devices fade each of them.
+     *
+     * @param target  The fade level at the end of the fade.
+     * @param jump    @b true to go straight to the target.
+     */
+    virtual void fadeDevices( uint8_t target, bool jump = false )
+    {
+    	device->fade( target, jump ? 0 : device->getFadeTime() );
+    };
+
+    /**
+     * @return Returns @b true until the fade of the LED Device has ended.
+     */
+    virtual bool isFading() { return device->isFading(); };
+
+    /**
+     * Called by display() at the end of each governor window.  Compares the
+     * average busy time of the window with the frame time and changes the
+     * quality level if needed.
+     */
+    void govern();
+
+  public:
+
     /**
      * Wrapper method for run(true).
      *
@@ -98,18 +396,21 @@ class LightShow
      * @param clear  Boolean flag.  If set to @b true, the LED Device will be reset to the
      *               default background color before starting the light show.  If set to
      *               @b false, the LED device will start the light show in the same state
-     *               in which it exited the previous light show.
+     *               in which it exited the previous light show.  A suspended light show
+     *               repaints the LED Device itself, so it is never cleared.
      */
     void run( bool clear )
     {
     	// To clear or not to clear the LED Device.
-    	if ( clear )
+    	if ( clear && ! suspended )
     	{
     		device->showBackground();
     	}
 
     	// Run the Light Show.
+    	current = this;
     	display();
+    	current = NULL;
     }
 
 };   // end of abstract class lightShow
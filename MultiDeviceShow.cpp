@@ -0,0 +1,78 @@
+/*
+ * MultiDeviceShow.cpp
+ *
+ *  Created on: Oct 18, 2026
+ *      Author: Steven F. LeBrun
+ */
+
+#include "MultiDeviceShow.h"
+
+MultiDeviceShow::MultiDeviceShow( LedDevice * dLEDs, unsigned long fDelay ) :
+	LightShow(dLEDs, fDelay), nDevices(1)
+{
+	devices[0] = dLEDs;
+}
+
+MultiDeviceShow::~MultiDeviceShow()
+{
+}
+
+bool MultiDeviceShow::addDevice( LedDevice * dLEDs )
+{
+	if ( nDevices >= MultiDeviceShow_MAX_DEVICES )
+	{
+		return false;
+	}
+
+	devices[nDevices++] = dLEDs;
+
+	return true;
+}
+
+void MultiDeviceShow::commitFrame()
+{
+	uint8_t  d;
+
+	for ( d = 0 ; d < nDevices ; ++d )
+	{
+		devices[d]->commit();
+	}
+}
+
+int MultiDeviceShow::numberOfLEDs()
+{
+	int      total = 0;
+	uint8_t  d;
+
+	for ( d = 0 ; d < nDevices ; ++d )
+	{
+		total += devices[d]->numberOfLEDs();
+	}
+
+	return total;
+}
+
+void MultiDeviceShow::fadeDevices( uint8_t target, bool jump )
+{
+	uint8_t  d;
+
+	for ( d = 0 ; d < nDevices ; ++d )
+	{
+		devices[d]->fade( target, jump ? 0 : devices[d]->getFadeTime() );
+	}
+}
+
+bool MultiDeviceShow::isFading()
+{
+	uint8_t  d;
+
+	for ( d = 0 ; d < nDevices ; ++d )
+	{
+		if ( devices[d]->isFading() )
+		{
+			return true;
+		}
+	}
+
+	return false;
+}
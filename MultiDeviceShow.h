@@ -0,0 +1,84 @@
+/**
+ * Base class for light shows that render onto several LED Devices.
+ *
+ *  @date   Created on October 18, 2026
+ *  @author Steven F. LeBrun
+ *  <br/><br/>
+ */
+
+#ifndef MULTIDEVICESHOW_H_
+#define MULTIDEVICESHOW_H_
+
+#include "LedDevice.h"
+#include "LightShow.h"
+
+/**
+ * The largest number of LED Devices a MultiDeviceShow can render onto.
+ */
+#define  MultiDeviceShow_MAX_DEVICES   4
+
+/**
+ * Light Show derived class that keeps a list of LED Devices, the device of
+ * the light show first, and commits, counts and fades all of them where
+ * LightShow only handles its own device.  The derived class renders onto
+ * each device in its nextFrame().
+ */
+class MultiDeviceShow: public LightShow
+{
+	protected:
+		/**
+		 * The devices rendered, the device of the light show first.
+		 */
+		LedDevice *  devices[MultiDeviceShow_MAX_DEVICES];
+
+		/**
+		 * The number of devices in use.
+		 */
+		uint8_t      nDevices;
+
+	public:
+		/**
+		 * Constructor.
+		 *
+		 * @param dLEDs   Pointer to the first LED Device to be used.
+		 * @param fDelay  The time, in milliseconds, from the start of one
+		 *                frame to the start of the next.
+		 */
+		MultiDeviceShow( LedDevice * dLEDs, unsigned long fDelay );
+
+		/**
+		 * Destructor.  The devices are owned by the creator of this object.
+		 */
+		virtual ~MultiDeviceShow();
+
+		/**
+		 * Adds another device to render onto.
+		 *
+		 * @param dLEDs  The device.
+		 * @return Returns @b false if there is no room for another device.
+		 */
+		virtual bool addDevice( LedDevice * dLEDs );
+
+	protected:
+		/**
+		 * Commits every device.
+		 */
+		virtual void commitFrame();
+
+		/**
+		 * @return Returns the number of LED units of every device.
+		 */
+		virtual int numberOfLEDs();
+
+		/**
+		 * Fades every device.
+		 */
+		virtual void fadeDevices( uint8_t target, bool jump = false );
+
+		/**
+		 * @return Returns @b true until every device has faded.
+		 */
+		virtual bool isFading();
+};
+
+#endif /* MULTIDEVICESHOW_H_ */
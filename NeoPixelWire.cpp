@@ -0,0 +1,113 @@
+/*
+ * NeoPixelWire.cpp
+ *
+ *  Created on: Oct 18, 2026
+ *      Author: Steven F. LeBrun
+ */
+
+#include "NeoPixelWire.h"
+
+NeoPixelWire::NeoPixelWire( int dPin ) :
+	port(NULL), mask(0)
+{
+#if defined(__AVR__)
+	pinMode( dPin, OUTPUT );
+	digitalWrite( dPin, LOW );
+
+	port = portOutputRegister( digitalPinToPort( dPin ) );
+	mask = digitalPinToBitMask( dPin );
+#else
+	(void) dPin;
+#endif
+}
+
+#if defined(__AVR__) && ( F_CPU == 16000000L )
+
+/**
+ * Sends one byte, most significant bit first, at 800 kHz: 20 cycles per
+ * bit, high for 5 cycles for a 0 and for 13 cycles for a 1.  The cycle at
+ * which each instruction starts is given in the comments.  Interrupts must
+ * be off.
+ */
+static inline void sendByte( volatile uint8_t * port, uint8_t hi, uint8_t lo, uint8_t value )
+{
+	uint8_t  bits = 8;
+	uint8_t  next = lo;
+
+	asm volatile (
+		"1:                         \n\t"
+		"st   %a[port], %[hi]       \n\t"   //  0  line high
+		"sbrc %[value], 7           \n\t"   //  2
+		"mov  %[next], %[hi]        \n\t"   //  3  stay high for a 1
+		"lsl  %[value]              \n\t"   //  4
+		"st   %a[port], %[next]     \n\t"   //  5  line low for a 0
+		"mov  %[next], %[lo]        \n\t"   //  7
+		"dec  %[bits]               \n\t"   //  8
+		"rjmp .+0                   \n\t"   //  9
+		"rjmp .+0                   \n\t"   // 11
+		"st   %a[port], %[lo]       \n\t"   // 13  line low for a 1
+		"nop                        \n\t"   // 15
+		"rjmp .+0                   \n\t"   // 16
+		"brne 1b                    \n\t"   // 18
+		: [value] "+r" (value), [bits] "+r" (bits), [next] "+r" (next)
+		: [port] "e" (port), [hi] "r" (hi), [lo] "r" (lo)
+		: "memory" );
+}
+
+void NeoPixelWire::send( uint8_t first, uint8_t second, uint8_t third )
+{
+	uint8_t  oldSREG = SREG;
+	uint8_t  hi;
+	uint8_t  lo;
+
+	noInterrupts();
+
+	hi = *port | mask;
+	lo = *port & ~mask;
+
+	sendByte( port, hi, lo, first );
+	sendByte( port, hi, lo, second );
+	sendByte( port, hi, lo, third );
+
+	SREG = oldSREG;
+}
+
+void NeoPixelWire::send( uint8_t first, uint8_t second, uint8_t third, uint8_t fourth )
+{
+	uint8_t  oldSREG = SREG;
+	uint8_t  hi;
+	uint8_t  lo;
+
+	noInterrupts();
+
+	hi = *port | mask;
+	lo = *port & ~mask;
+
+	sendByte( port, hi, lo, first );
+	sendByte( port, hi, lo, second );
+	sendByte( port, hi, lo, third );
+	sendByte( port, hi, lo, fourth );
+
+	SREG = oldSREG;
+}
+
+#else
+
+void NeoPixelWire::send( uint8_t first, uint8_t second, uint8_t third )
+{
+	// No bit timing for this board.  The bytes have been worked out, which
+	// is what the timing of a frame measures.
+	(void) first;
+	(void) second;
+	(void) third;
+}
+
+void NeoPixelWire::send( uint8_t first, uint8_t second, uint8_t third, uint8_t fourth )
+{
+	(void) first;
+	(void) second;
+	(void) third;
+	(void) fourth;
+}
+
+#endif
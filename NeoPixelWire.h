@@ -0,0 +1,64 @@
+/**
+ * The data line of a strip of WS2812B or SK6812 LED units, driven by the
+ * sketch itself rather than by a FastLED controller.
+ *
+ *  @date   Created on October 18, 2026
+ *  @author Steven F. LeBrun
+ *  <br/><br/>
+ */
+
+#ifndef NEOPIXELWIRE_H_
+#define NEOPIXELWIRE_H_
+
+#include <Arduino.h>
+
+/**
+ * Sends the bytes of one LED unit at a time down an 800 kHz data line.
+ * Used by the devices that work out the bytes of each LED unit just before
+ * it is sent: ShaderDevice, which has no color array, and LedRgbwStrip,
+ * which turns each color into four bytes.
+ *
+ * Interrupts are turned off while the bytes of an LED unit are sent and
+ * turned back on between LED units.  The data line is low in between, so
+ * the work done for the next LED unit must take less than the latch time
+ * of the LED units.  The caller holds the line low after the last LED unit
+ * so that they latch the new colors.
+ *
+ * The bit timing is written for an AVR at 16 MHz.  On other boards nothing
+ * is sent.
+ */
+class NeoPixelWire
+{
+	private:
+		/**
+		 * The output register of the data pin.
+		 */
+		volatile uint8_t *  port;
+
+		/**
+		 * The bit of the data pin in its output register.
+		 */
+		uint8_t             mask;
+
+	public:
+		/**
+		 * Constructor.  Sets the data pin to an output, held low.
+		 *
+		 * @param dPin  The Arduino GPIO pin the data line is connected to.
+		 */
+		NeoPixelWire( int dPin );
+
+		/**
+		 * Sends the three bytes of an RGB LED unit, in the order the LED
+		 * units expect them, green first for a WS2812B.
+		 */
+		void send( uint8_t first, uint8_t second, uint8_t third );
+
+		/**
+		 * Sends the four bytes of an RGBW LED unit, in the order the LED
+		 * units expect them, green, red, blue and white for an SK6812.
+		 */
+		void send( uint8_t first, uint8_t second, uint8_t third, uint8_t fourth );
+};
+
+#endif /* NEOPIXELWIRE_H_ */
@@ -0,0 +1,51 @@
+/*
+ * PaletteShow.cpp
+ *
+ *  Created on: Oct 18, 2026
+ *      Author: Steven F. LeBrun
+ */
+
+#include "Colors.h"
+#include "PaletteShow.h"
+
+/**
+ * The time between frames in milliseconds, 100 frames per second.
+ */
+const int PaletteShow::PALETTE_DELAY = 10;
+
+PaletteShow::PaletteShow( LedDevice * dLEDs, const uint8_t * palette, uint8_t speed ) :
+	LightShow(dLEDs, PALETTE_DELAY), palette(palette), offset(0), speed(speed), spread(1)
+{
+}
+
+PaletteShow::~PaletteShow()
+{
+}
+
+void PaletteShow::start()
+{
+	int  maxLEDs = device->numberOfLEDs();
+
+	offset = 0;
+	spread = ( maxLEDs < 256 ) ? 256 / maxLEDs : 1;
+}
+
+bool PaletteShow::nextFrame()
+{
+	CRGB * leds    = device->getLEDs();
+	int    maxLEDs = device->numberOfLEDs();
+
+	if ( palette == NULL )
+	{
+		Colors::fillRainbow( leds, maxLEDs, offset, spread );
+	}
+	else
+	{
+		Colors::fillPalette( leds, maxLEDs, palette, offset, spread );
+	}
+
+	device->setChanged();
+	offset += speed;
+
+	return true;
+}
@@ -0,0 +1,94 @@
+/**
+ * Light Show that scrolls a gradient palette or a rainbow along the LED
+ * Device.
+ *
+ *  @date   Created on October 18, 2026
+ *  @author Steven F. LeBrun
+ *  <br/><br/>
+ */
+
+#ifndef PALETTESHOW_H_
+#define PALETTESHOW_H_
+
+#include "LedDevice.h"
+#include "LightShow.h"
+
+/**
+ * Light Show derived class that sets every LED unit on every frame from a
+ * gradient palette, @see Colors::paletteColor(), or from the color wheel,
+ * @see Colors::hsvColor().  The whole palette is spread across the device
+ * and moves along it a little on each frame.
+ *
+ * Both color sources are table lookups in flash, so the default frame
+ * time of 10 milliseconds, 100 frames per second, can be kept on the
+ * 60 LED strip.
+ */
+class PaletteShow: public LightShow
+{
+	private:
+		/**
+		 * The default time, in milliseconds, between frames.
+		 */
+		static const int PALETTE_DELAY;
+
+		/**
+		 * The palette in flash, or NULL for the color wheel.
+		 */
+		const uint8_t * palette;
+
+		/**
+		 * The palette position of the first LED unit.
+		 */
+		uint8_t  offset;
+
+		/**
+		 * The amount the palette position of the first LED unit moves
+		 * on each frame.
+		 */
+		uint8_t  speed;
+
+		/**
+		 * The amount the palette position moves from one LED unit to the
+		 * next.  Set by start() so the palette spans the device.
+		 */
+		uint8_t  spread;
+
+	public:
+		/**
+		 * Constructor.
+		 *
+		 * @param dLEDs    Pointer to the LED Device to be used.
+		 * @param palette  A palette in flash, such as Colors::HEAT_PALETTE,
+		 *                 or NULL to use the color wheel.
+		 * @param speed    The palette positions moved on each frame.
+		 */
+		PaletteShow( LedDevice * dLEDs, const uint8_t * palette = NULL, uint8_t speed = 2 );
+
+		/**
+		 * Destructor.
+		 *
+		 * Note, the resources of the LED Device are not released by this
+		 * destructor because the LED Device object is owned and is the
+		 * responsibility of another object.
+		 */
+		virtual ~PaletteShow();
+
+		/**
+		 * Starts the palette at the first LED unit.
+		 */
+		virtual void start();
+
+		/**
+		 * Sets every LED unit and moves the palette along.
+		 *
+		 * @return Always returns @b true.
+		 */
+		virtual bool nextFrame();
+
+		/**
+		 * @return Returns SHOW_PALETTE.
+		 */
+		virtual uint8_t getShowType() { return SHOW_PALETTE; };
+};
+
+#endif /* PALETTESHOW_H_ */
@@ -0,0 +1,131 @@
+/*
+ * ParticleSparkle.cpp
+ *
+ *  Created on: Oct 18, 2026
+ *      Author: Steven F. LeBrun
+ */
+
+#include "Colors.h"
+#include "ParticleSparkle.h"
+
+/**
+ * The time between frames in milliseconds.
+ */
+const int ParticleSparkle::PARTICLE_DELAY = 20;
+
+ParticleSparkle::ParticleSparkle( LedDevice * dLEDs, uint8_t spawn, uint8_t fade ) :
+	LightShow(dLEDs, PARTICLE_DELAY), lit(ParticleSparkle_NONE), available(ParticleSparkle_NONE),
+	spawn(spawn), fade(fade)
+{
+}
+
+ParticleSparkle::~ParticleSparkle()
+{
+}
+
+void ParticleSparkle::start()
+{
+	uint8_t  p;
+
+	for ( p = 0 ; p < ParticleSparkle_MAX_PARTICLES ; ++p )
+	{
+		pool[p].next = p + 1;
+	}
+
+	pool[ParticleSparkle_MAX_PARTICLES - 1].next = ParticleSparkle_NONE;
+
+	available = 0;
+	lit       = ParticleSparkle_NONE;
+
+	device->setLEDsBackground();
+}
+
+void ParticleSparkle::resume()
+{
+	uint8_t  p;
+
+	device->setLEDsBackground();
+
+	for ( p = lit ; p != ParticleSparkle_NONE ; p = pool[p].next )
+	{
+		CRGB  color = pool[p].color;
+
+		device->setLED( pool[p].position, color.nscale8( pool[p].life ) );
+	}
+}
+
+bool ParticleSparkle::isLit( uint16_t position )
+{
+	uint8_t  p;
+
+	for ( p = lit ; p != ParticleSparkle_NONE ; p = pool[p].next )
+	{
+		if ( pool[p].position == position )
+		{
+			return true;
+		}
+	}
+
+	return false;
+}
+
+bool ParticleSparkle::nextFrame()
+{
+	uint8_t *  link = &lit;
+	uint8_t    p;
+	uint8_t    n;
+
+	// Fade the lit particles, unlinking the ones that have gone dark.
+	while ( *link != ParticleSparkle_NONE )
+	{
+		Particle &  particle = pool[*link];
+
+		particle.life = scale8( particle.life, fade );
+
+		if ( particle.life < ParticleSparkle_MIN_LIFE )
+		{
+			device->setLED( particle.position, device->getBackground() );
+
+			p         = *link;
+			*link     = particle.next;
+			particle.next = available;
+			available = p;
+		}
+		else
+		{
+			CRGB  color = particle.color;
+
+			device->setLED( particle.position, color.nscale8( particle.life ) );
+			link = &particle.next;
+		}
+	}
+
+	// Start new sparkles while there are free particles.
+	// Half as many new sparkles when the frame governor has reduced the quality.
+	for ( n = random8( ( ( quality == QUALITY_FULL ) ? spawn : spawn / 2 ) + 1 ) ; n > 0 && available != ParticleSparkle_NONE ; --n )
+	{
+		uint16_t  position = random16( device->numberOfLEDs() );
+
+		// Each LED unit has at most one particle, so a particle that goes
+		// dark never clears the LED unit of another.
+		if ( isLit( position ) )
+		{
+			continue;
+		}
+
+		p = available;
+
+		Particle &  particle = pool[p];
+
+		available         = particle.next;
+		particle.color    = Colors::randomJustColor();
+		particle.position = position;
+		particle.life     = 255;
+		particle.next     = lit;
+		lit               = p;
+
+		device->setLED( particle.position, particle.color );
+	}
+
+	return true;
+}
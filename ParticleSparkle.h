@@ -0,0 +1,159 @@
+/**
+ * Light Show that displays sparkles which fade away.
+ *
+ *  @date   Created on October 18, 2026
+ *  @author Steven F. LeBrun
+ *  <br/><br/>
+ */
+
+#ifndef PARTICLESPARKLE_H_
+#define PARTICLESPARKLE_H_
+
+#include "LedDevice.h"
+#include "LightShow.h"
+
+/**
+ * The number of sparkles that can be lit at the same time.  The pool is
+ * part of the object, so each sparkle costs 7 bytes of RAM.  Must be less
+ * than 255.
+ */
+#ifndef  ParticleSparkle_MAX_PARTICLES
+#define  ParticleSparkle_MAX_PARTICLES  24
+#endif
+
+/**
+ * Marks the end of a list of particles.
+ */
+#define  ParticleSparkle_NONE          0xFF
+
+/**
+ * A sparkle is put back in the pool once its brightness drops below this.
+ */
+#define  ParticleSparkle_MIN_LIFE      8
+
+/**
+ * Light Show derived class that lights random LED units which then fade
+ * back to the background color.
+ *
+ * Each lit LED unit is a particle taken from a fixed pool inside the
+ * object, so no memory is allocated while the show runs.  The particles
+ * are kept on two singly linked lists, the lit ones and the free ones, so
+ * a frame only visits the lit particles and its cost depends on how many
+ * sparkles are lit rather than on the number of LED units.  Only the LED
+ * units of lit particles are written; the rest keep the background color
+ * set by start().
+ *
+ * @pre randomSeed() must be called before the show is run, @see SparkleLEDs.
+ */
+class ParticleSparkle: public LightShow
+{
+	private:
+		/**
+		 * The default time, in milliseconds, between frames.
+		 */
+		static const int PARTICLE_DELAY;
+
+		/**
+		 * One sparkle.
+		 */
+		struct Particle
+		{
+			/**
+			 * The color of the sparkle at full brightness.
+			 */
+			CRGB      color;
+
+			/**
+			 * The offset of the LED unit the sparkle is on.
+			 */
+			uint16_t  position;
+
+			/**
+			 * The brightness of the sparkle, scaled down on each frame.
+			 */
+			uint8_t   life;
+
+			/**
+			 * The index of the next particle in the same list.
+			 */
+			uint8_t   next;
+		};
+
+		/**
+		 * The pool of particles.
+		 */
+		Particle  pool[ParticleSparkle_MAX_PARTICLES];
+
+		/**
+		 * The index of the first lit particle.
+		 */
+		uint8_t   lit;
+
+		/**
+		 * The index of the first free particle.
+		 */
+		uint8_t   available;
+
+		/**
+		 * The largest number of sparkles started on each frame.
+		 */
+		uint8_t   spawn;
+
+		/**
+		 * The factor, out of 256, each sparkle is scaled by on each frame.
+		 */
+		uint8_t   fade;
+
+		/**
+		 * @return Returns @b true if a lit particle is at the position.
+		 */
+		bool isLit( uint16_t position );
+
+	public:
+		/**
+		 * Constructor.
+		 *
+		 * @param dLEDs  Pointer to the LED Device to be used.
+		 * @param spawn  The largest number of sparkles started on each frame.
+		 * @param fade   The factor, out of 256, each sparkle is scaled by on
+		 *               each frame.  Higher values fade more slowly.
+		 */
+		ParticleSparkle( LedDevice * dLEDs, uint8_t spawn = 2, uint8_t fade = 224 );
+
+		/**
+		 * Destructor.
+		 *
+		 * Note, the resources of the LED Device are not released by this
+		 * destructor because the LED Device object is owned and is the
+		 * responsibility of another object.
+		 */
+		virtual ~ParticleSparkle();
+
+		/**
+		 * Puts every particle back in the pool and sets every LED unit to
+		 * the background color.
+		 */
+		virtual void start();
+
+		/**
+		 * Sets every LED unit to the background color and repaints the lit
+		 * sparkles.
+		 */
+		virtual void resume();
+
+		/**
+		 * Fades the lit sparkles, returns the dark ones to the pool and
+		 * starts new ones.  The light show runs until a Mode Change
+		 * Interrupt has been detected.
+		 *
+		 * @return Always returns @b true.
+		 */
+		virtual bool nextFrame();
+
+		/**
+		 * @return Returns SHOW_PARTICLES.
+		 */
+		virtual uint8_t getShowType() { return SHOW_PARTICLES; };
+};
+
+#endif /* PARTICLESPARKLE_H_ */
@@ -0,0 +1,49 @@
+/*
+ * PixelShader.cpp
+ *
+ *  Created on: Oct 18, 2026
+ *      Author: Steven F. LeBrun
+ */
+
+#include "PixelShader.h"
+#include "ShaderDevice.h"
+
+PixelShader::PixelShader( LedDevice * dLEDs, unsigned long fDelay ) :
+	LightShow(dLEDs, fDelay)
+{
+}
+
+PixelShader::~PixelShader()
+{
+}
+
+bool PixelShader::nextFrame()
+{
+	CRGB *  leds = device->getLEDs();
+	int     maxLEDs;
+	int     i;
+
+	if ( ! prepare() )
+	{
+		return false;
+	}
+
+	if ( leds == NULL )
+	{
+		// Only a ShaderDevice has no color array.  It asks this light show
+		// for the colors as it sends them.
+		static_cast<ShaderDevice *>( device )->setShader( this );
+		return true;
+	}
+
+	maxLEDs = device->numberOfLEDs();
+
+	for ( i = 0 ; i < maxLEDs ; ++i )
+	{
+		leds[i] = shade( i );
+	}
+
+	device->setChanged();
+
+	return true;
+}
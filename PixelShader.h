@@ -0,0 +1,74 @@
+/**
+ * Light Show defined by a function that gives the color of any LED unit,
+ * so that it can be evaluated while the colors are sent instead of being
+ * kept in a color array.
+ *
+ *  @date   Created on October 18, 2026
+ *  @author Steven F. LeBrun
+ *  <br/><br/>
+ */
+
+#ifndef PIXELSHADER_H_
+#define PIXELSHADER_H_
+
+#include "LedDevice.h"
+#include "LightShow.h"
+
+/**
+ * Light Show derived class for light shows that can give the color of each
+ * LED unit on its own.  The derived class updates its state once per frame
+ * in prepare() and gives the color of one LED unit in shade().
+ *
+ * On a device with a color array nextFrame() fills the array from shade(),
+ * so a pixel shader runs on any LED Device.  On a ShaderDevice, which has
+ * no color array, nextFrame() only calls prepare() and the device calls
+ * shade() for each LED unit while it sends the frame, so the number of LED
+ * units is not limited by RAM.
+ *
+ * shade() is called between two LED units on the data line, so it must be
+ * short: the data line is held low while it runs, and LED units latch the
+ * colors they have if it is held low for more than a few microseconds.
+ */
+class PixelShader: public LightShow
+{
+	public:
+		/**
+		 * Constructor.
+		 *
+		 * @param dLEDs  A pointer to the LED Device the light show runs on.
+		 * @param fDelay The time, in milliseconds, from the start of one
+		 *               frame to the start of the next.
+		 */
+		PixelShader( LedDevice * dLEDs, unsigned long fDelay );
+
+		/**
+		 * Destructor.
+		 */
+		virtual ~PixelShader();
+
+		/**
+		 * Updates the state of the light show for the next frame.
+		 *
+		 * @return Returns @b false if the light show has finished.
+		 */
+		virtual bool prepare() = 0;
+
+		/**
+		 * Gives the color of one LED unit for the current frame.
+		 *
+		 * @param index  The offset of the LED unit.
+		 * @return Returns the color of the LED unit.
+		 */
+		virtual CRGB shade( int index ) = 0;
+
+		/**
+		 * Calls prepare() and, on a device with a color array, sets every
+		 * LED unit from shade().  On a ShaderDevice the light show becomes
+		 * the source of the colors the device sends.
+		 *
+		 * @return Returns @b false if the light show has finished.
+		 */
+		virtual bool nextFrame();
+};
+
+#endif /* PIXELSHADER_H_ */
@@ -0,0 +1,341 @@
+/*
+ * ProgramShow.cpp
+ *
+ *  Created on: Oct 18, 2026
+ *      Author: Steven F. LeBrun
+ */
+
+#include <EEPROM.h>
+
+#include "Clock.h"
+#include "Colors.h"
+#include "EventLog.h"
+#include "ProgramShow.h"
+
+uint8_t  ProgramShow::loads = 0;
+
+// Built from extras/programs/sweeper.lss by extras/ShowAssembler.cpp.
+const uint8_t ProgramShow::SWEEPER_PROGRAM[] PROGMEM =
+				{
+						0xB5,  48,   0,
+						  4,  16,   2,   1,  12,   3,   0,   0,   6,   3,  13,   3,
+						  1,   0,  18,   2,   8,   0,   1,   1,  17,   0,  15,   0,
+						  1,  16,   2,   0,   8,   1,   1,  18,   2,  28,   0,  16,
+						  2,   0,   9,   1,   1,  18,   2,  38,   0,  19,  20,   0
+				};
+
+ProgramShow::ProgramShow( LedDevice * dLEDs, const uint8_t * program, const uint8_t * palette ) :
+	LightShow(dLEDs), program(program), source(program), inEeprom(false),
+	palette(( palette != NULL ) ? palette : Colors::RAINBOW_PALETTE),
+	length(0), pc(0), waiting(0), depth(0), loaded(0), code(NULL)
+{
+	uint8_t  r;
+
+	for ( r = 0 ; r < ShowProgram_REGISTERS ; ++r )
+	{
+		registers[r] = 0;
+	}
+}
+
+ProgramShow::~ProgramShow()
+{
+}
+
+uint8_t ProgramShow::eepromByte( uint16_t offset )
+{
+	return EEPROM.read( ProgramShow_EEPROM_ADDRESS + offset );
+}
+
+uint16_t ProgramShow::fetchWord()
+{
+	uint8_t  low = fetch();
+
+	return low | ( (uint16_t) fetch() << 8 );
+}
+
+CRGB ProgramShow::fetchColor()
+{
+	uint8_t  red   = fetch();
+	uint8_t  green = fetch();
+
+	return CRGB( red, green, fetch() );
+}
+
+void ProgramShow::start()
+{
+	source   = program;
+	inEeprom = false;
+
+	if ( program == NULL )
+	{
+		if ( EEPROM.read( ProgramShow_EEPROM_ADDRESS ) == ShowProgram_MAGIC )
+		{
+			inEeprom = true;
+		}
+		else
+		{
+			source = SWEEPER_PROGRAM;
+		}
+	}
+
+	code    = inEeprom ? NULL : source + ShowProgram_HEADER_SIZE;
+	length  = ( imageByte( 0 ) == ShowProgram_MAGIC ) ? imageByte( 1 ) | ( (uint16_t) imageByte( 2 ) << 8 ) : 0;
+	pc      = 0;
+	waiting = 0;
+	depth   = 0;
+	loaded  = loads;
+}
+
+bool ProgramShow::nextFrame()
+{
+	int  maxLEDs = device->numberOfLEDs();
+	int  steps;
+
+	if ( program == NULL && loaded != loads )
+	{
+		start();
+	}
+
+	if ( waiting > 0 )
+	{
+		--waiting;
+		return true;
+	}
+
+	for ( steps = 0 ; steps < ProgramShow_MAX_STEPS ; ++steps )
+	{
+		if ( pc >= length )
+		{
+			return false;
+		}
+
+		switch ( fetch() )
+		{
+			case OP_END:
+				return false;
+
+			case OP_WAIT:
+				waiting = fetch();
+				if ( waiting > 0 )
+				{
+					--waiting;
+				}
+				return true;
+
+			case OP_FILL:
+				device->setLEDs( fetchColor() );
+				break;
+
+			case OP_FILL_FG:
+				device->setLEDsForeground();
+				break;
+
+			case OP_FILL_BG:
+				device->setLEDsBackground();
+				break;
+
+			case OP_SET:
+			{
+				int16_t  led   = fetchRegister();
+				CRGB     color = fetchColor();
+
+				if ( led >= 0 && led < maxLEDs )
+				{
+					device->setLED( led, color );
+				}
+				break;
+			}
+
+			case OP_SET_FG:
+			{
+				int16_t  led = fetchRegister();
+
+				if ( led >= 0 && led < maxLEDs )
+				{
+					device->setLED( led, device->getForeground() );
+				}
+				break;
+			}
+
+			case OP_SET_BG:
+			{
+				int16_t  led = fetchRegister();
+
+				if ( led >= 0 && led < maxLEDs )
+				{
+					device->setLED( led, device->getBackground() );
+				}
+				break;
+			}
+
+			case OP_ADVANCE:
+				device->advanceLEDs();
+				break;
+
+			case OP_RETREAT:
+				device->retreatLEDs();
+				break;
+
+			case OP_PALETTE:
+			{
+				int16_t  led      = fetchRegister();
+				uint8_t  position = (uint8_t) fetchRegister();
+
+				if ( led >= 0 && led < maxLEDs )
+				{
+					device->setLED( led, Colors::paletteColor( palette, position ) );
+				}
+				break;
+			}
+
+			case OP_RANDOM:
+			{
+				int16_t &  r     = fetchRegister();
+				int16_t    limit = fetchRegister();
+
+				r = ( limit > 0 ) ? (int16_t) random( limit ) : 0;
+				break;
+			}
+
+			case OP_LOAD:
+			{
+				int16_t &  r = fetchRegister();
+
+				r = (int16_t) fetchWord();
+				break;
+			}
+
+			case OP_ADD:
+			{
+				int16_t &  r = fetchRegister();
+
+				r += (int16_t) fetchWord();
+				break;
+			}
+
+			case OP_ADD_REG:
+			{
+				int16_t &  r = fetchRegister();
+
+				r += fetchRegister();
+				break;
+			}
+
+			case OP_SUB_REG:
+			{
+				int16_t &  r = fetchRegister();
+
+				r -= fetchRegister();
+				break;
+			}
+
+			case OP_MOVE:
+			{
+				int16_t &  r = fetchRegister();
+
+				r = fetchRegister();
+				break;
+			}
+
+			case OP_LEDS:
+				fetchRegister() = (int16_t) maxLEDs;
+				break;
+
+			case OP_LOOP:
+			{
+				int16_t &  r  = fetchRegister();
+				uint16_t   to = fetchWord();
+
+				if ( --r > 0 )
+				{
+					pc = to;
+				}
+				break;
+			}
+
+			case OP_JUMP:
+				pc = fetchWord();
+				break;
+
+			case OP_PUSH:
+				if ( depth >= ShowProgram_STACK )
+				{
+					return false;
+				}
+				stack[depth++] = fetchRegister();
+				break;
+
+			case OP_POP:
+				if ( depth == 0 )
+				{
+					return false;
+				}
+				fetchRegister() = stack[--depth];
+				break;
+
+			default:
+				return false;
+		}
+	}
+
+	// A program that never waits still shows its frames.
+	return true;
+}
+
+/**
+ * @return Returns the next byte from the serial port, or -1 if none came
+ *         within ProgramShow_RECEIVE_MS.
+ */
+static int receiveByte()
+{
+	unsigned long  started = Clock::millis();
+
+	while ( Serial.available() <= 0 )
+	{
+		if ( Clock::millis() - started >= ProgramShow_RECEIVE_MS )
+		{
+			return -1;
+		}
+	}
+
+	return Serial.read();
+}
+
+void ProgramShow::receive()
+{
+	uint16_t  room   = EEPROM.length() - ProgramShow_EEPROM_ADDRESS - ShowProgram_HEADER_SIZE;
+	int       magic  = receiveByte();
+	int       low    = receiveByte();
+	int       high   = receiveByte();
+	uint16_t  length = (uint16_t) ( low | ( high << 8 ) );
+	uint16_t  i;
+
+	// The old image is not valid once any of it has been written over.
+	EEPROM.update( ProgramShow_EEPROM_ADDRESS, 0 );
+	++loads;
+
+	if ( magic != ShowProgram_MAGIC || low < 0 || high < 0 || length > room )
+	{
+		EventLog::log( LOG_PROGRAM, 0 );
+		return;
+	}
+
+	for ( i = 0 ; i < length ; ++i )
+	{
+		int  b = receiveByte();
+
+		if ( b < 0 )
+		{
+			EventLog::log( LOG_PROGRAM, 0 );
+			return;
+		}
+
+		EEPROM.update( ProgramShow_EEPROM_ADDRESS + ShowProgram_HEADER_SIZE + i, (uint8_t) b );
+	}
+
+	EEPROM.update( ProgramShow_EEPROM_ADDRESS + 1, lowByte(length) );
+	EEPROM.update( ProgramShow_EEPROM_ADDRESS + 2, highByte(length) );
+	EEPROM.update( ProgramShow_EEPROM_ADDRESS, ShowProgram_MAGIC );
+
+	EventLog::log( LOG_PROGRAM, length );
+}
@@ -0,0 +1,223 @@
+/**
+ * Light Show that runs a program of byte code, so that new light shows can
+ * be loaded into EEPROM without building the sketch again.
+ *
+ *  @date   Created on October 18, 2026
+ *  @author Steven F. LeBrun
+ *  <br/><br/>
+ */
+
+#ifndef PROGRAMSHOW_H_
+#define PROGRAMSHOW_H_
+
+#include "LedDevice.h"
+#include "LightShow.h"
+#include "ShowProgramFormat.h"
+
+/**
+ * The offset in EEPROM of the program image loaded by receive().
+ */
+#define  ProgramShow_EEPROM_ADDRESS  0
+
+/**
+ * The largest number of instructions run in one frame.  A program that
+ * runs this many without a wait instruction has its frame shown anyway,
+ * so a mode change is still seen.
+ */
+#define  ProgramShow_MAX_STEPS       2048
+
+/**
+ * How long receive() waits for each byte, in milliseconds.
+ */
+#define  ProgramShow_RECEIVE_MS      1000
+
+/**
+ * Light Show derived class that runs a program image, @see
+ * ShowProgramFormat.h, from flash or from EEPROM.  The programs are built
+ * by the host side assembler, extras/ShowAssembler.cpp.
+ *
+ * Each frame runs instructions until a wait instruction, which shows the
+ * frame for a number of frames.  The instructions are fetched one byte at
+ * a time and dispatched through a single switch, which the compiler turns
+ * into a jump table; a frame of a program that moves the LED units costs
+ * little more than the move itself, @see BENCH_PROGRAM_SWEEP.
+ *
+ * Registers that name an LED unit outside the device, jumps outside the
+ * program and overflow of the stack are checked; the first leaves the LED
+ * unit alone and the others end the light show.
+ */
+class ProgramShow: public LightShow
+{
+	private:
+		/**
+		 * The program image in flash, or NULL for the one in EEPROM.
+		 */
+		const uint8_t * program;
+
+		/**
+		 * The program image being run: program, the image in EEPROM, or
+		 * SWEEPER_PROGRAM if there is none in EEPROM.
+		 */
+		const uint8_t * source;
+
+		/**
+		 * Set if the program being run is in EEPROM.
+		 */
+		bool            inEeprom;
+
+		/**
+		 * The palette in flash used by the palette instruction.
+		 */
+		const uint8_t * palette;
+
+		/**
+		 * The number of bytes of code.
+		 */
+		uint16_t        length;
+
+		/**
+		 * The offset of the next instruction in the code.
+		 */
+		uint16_t        pc;
+
+		/**
+		 * The frames still to be shown before the next instruction.
+		 */
+		uint8_t         waiting;
+
+		/**
+		 * The number of values on the stack.
+		 */
+		uint8_t         depth;
+
+		/**
+		 * The value of loads when the program was started.
+		 */
+		uint8_t         loaded;
+
+		/**
+		 * The number of programs received into EEPROM, so that a light
+		 * show running the old one starts the new one.
+		 */
+		static uint8_t  loads;
+
+		/**
+		 * The registers.
+		 */
+		int16_t         registers[ShowProgram_REGISTERS];
+
+		/**
+		 * The stack.
+		 */
+		int16_t         stack[ShowProgram_STACK];
+
+		/**
+		 * The code of the program image in flash, or NULL.
+		 */
+		const uint8_t * code;
+
+		/**
+		 * @return Returns a byte of the program image in EEPROM.
+		 */
+		uint8_t eepromByte( uint16_t offset );
+
+		/**
+		 * @return Returns a byte of the program image being run.
+		 */
+		uint8_t imageByte( uint16_t offset )
+		{
+			return inEeprom ? eepromByte( offset ) : pgm_read_byte( source + offset );
+		};
+
+		/**
+		 * @return Returns the next byte of code and moves past it.  Inline,
+		 *         as it is the heart of the dispatch loop.
+		 */
+		uint8_t fetch()
+		{
+			return inEeprom ? eepromByte( ShowProgram_HEADER_SIZE + pc++ ) : pgm_read_byte( code + pc++ );
+		};
+
+		/**
+		 * @return Returns the next two bytes of code as a 16 bit value.
+		 */
+		uint16_t fetchWord();
+
+		/**
+		 * @return Returns the register named by the next byte of code.
+		 */
+		int16_t & fetchRegister() { return registers[fetch() & ( ShowProgram_REGISTERS - 1 )]; };
+
+		/**
+		 * @return Returns the color in the next three bytes of code.
+		 */
+		CRGB fetchColor();
+
+	public:
+		/**
+		 * A program image in flash that sweeps a block of the foreground
+		 * color along the device and back, like the Sweeper class.  The
+		 * number of LED units in the block is register 1.  Built from
+		 * extras/programs/sweeper.lss.
+		 */
+		static const uint8_t  SWEEPER_PROGRAM[];
+
+		/**
+		 * Constructor.
+		 *
+		 * @param dLEDs    Pointer to the LED Device to be used.
+		 * @param program  A program image in flash, or NULL to run the
+		 *                 one loaded into EEPROM by receive().
+		 * @param palette  The palette in flash for the palette
+		 *                 instruction, such as Colors::RAINBOW_PALETTE.
+		 */
+		ProgramShow( LedDevice * dLEDs, const uint8_t * program = NULL, const uint8_t * palette = NULL );
+
+		/**
+		 * Destructor.
+		 *
+		 * Note, the resources of the LED Device are not released by this
+		 * destructor because the LED Device object is owned and is the
+		 * responsibility of another object.
+		 */
+		virtual ~ProgramShow();
+
+		/**
+		 * Starts the program at its first instruction.  The registers keep
+		 * their values.
+		 */
+		virtual void start();
+
+		/**
+		 * Runs the program up to its next wait instruction.  Starts again
+		 * if a new program has been received into EEPROM since the
+		 * program in EEPROM was started.
+		 *
+		 * @return Returns @b false when the program ends.
+		 */
+		virtual bool nextFrame();
+
+		/**
+		 * Sets a register, to pass a parameter to the program.
+		 *
+		 * @param r      The register, [0..ShowProgram_REGISTERS).
+		 * @param value  The value.
+		 */
+		void setRegister( uint8_t r, int16_t value ) { registers[r & ( ShowProgram_REGISTERS - 1 )] = value; };
+
+		/**
+		 * @return Returns SHOW_PROGRAM.
+		 */
+		virtual uint8_t getShowType() { return SHOW_PROGRAM; };
+
+		/**
+		 * Reads a program image from the serial port, as written by
+		 * extras/ShowAssembler.cpp, and stores it in EEPROM.  Writes a
+		 * LOG_PROGRAM record with the number of bytes of code, or zero if
+		 * the image was not valid or did not arrive in time, in which case
+		 * the image in EEPROM is marked as not valid.
+		 */
+		static void receive();
+};
+
+#endif /* PROGRAMSHOW_H_ */
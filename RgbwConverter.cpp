@@ -0,0 +1,32 @@
+/*
+ * RgbwConverter.cpp
+ *
+ *  Created on: Oct 18, 2026
+ *      Author: Steven F. LeBrun
+ */
+
+#include "RgbwConverter.h"
+
+RgbwConverter::RgbwConverter() :
+	white(CRGB::White), calibrated(false)
+{
+	setWhite( CRGB::White );
+}
+
+void RgbwConverter::setWhite( CRGB color )
+{
+	uint8_t  c;
+
+	for ( c = 0 ; c < 3 ; ++c )
+	{
+		if ( color.raw[c] == 0 )
+		{
+			color.raw[c] = 1;
+		}
+
+		inverse[c] = (uint16_t) ( ( 255UL << 8 ) / color.raw[c] );
+	}
+
+	white      = color;
+	calibrated = ( color != CRGB( CRGB::White ) );
+}
@@ -0,0 +1,126 @@
+/**
+ * Turns the RGB colors the light shows render into the four channels of
+ * LED units with a white LED.
+ *
+ *  @date   Created on October 18, 2026
+ *  @author Steven F. LeBrun
+ *  <br/><br/>
+ */
+
+#ifndef RGBWCONVERTER_H_
+#define RGBWCONVERTER_H_
+
+#include <FastLED.h>
+
+/**
+ * The four channels of an RGBW LED unit.
+ */
+struct RgbwPixel
+{
+	uint8_t  r;   ///< Red.
+	uint8_t  g;   ///< Green.
+	uint8_t  b;   ///< Blue.
+	uint8_t  w;   ///< White.
+};
+
+/**
+ * Moves the part of an RGB color that the white LED can show onto the
+ * white channel, one LED unit at a time, so that a device can turn the
+ * colors as it sends them and keep three bytes per LED unit in RAM.
+ *
+ * By default the white LED is taken to be pure white and the white channel
+ * is the smallest of the three channels, which is taken off each of them.
+ * Most white LEDs are warmer or cooler than that; after setWhite() the
+ * white channel is the most of the white LED that fits under the color,
+ * worked out with a multiply per channel rather than a division, and the
+ * light it adds is taken off each channel.
+ */
+class RgbwConverter
+{
+	private:
+		/**
+		 * The color of the white LED at full, in terms of the RGB LEDs.
+		 */
+		CRGB      white;
+
+		/**
+		 * 255 * 256 divided by each channel of white, so that multiplying
+		 * a channel by it and dropping the low byte gives the level of the
+		 * white LED that matches that channel.
+		 */
+		uint16_t  inverse[3];
+
+		/**
+		 * Set to @b false while the white LED is pure white.
+		 */
+		bool      calibrated;
+
+	public:
+		/**
+		 * Constructor.  The white LED is taken to be pure white.
+		 */
+		RgbwConverter();
+
+		/**
+		 * Sets the color of the white LED.
+		 *
+		 * @param color  The color the white LED shows at full, in terms of
+		 *               the RGB LEDs at full, for example CRGB( 255, 200, 140 )
+		 *               for a warm white.  Channels of zero are taken as one.
+		 *               CRGB::White gives the smallest channel method.
+		 */
+		void setWhite( CRGB color );
+
+		/**
+		 * @return Returns the color of the white LED set with setWhite().
+		 */
+		CRGB getWhite() { return white; };
+
+		/**
+		 * Converts one color.  Inline, since it is called for every LED
+		 * unit of every frame.
+		 *
+		 * @param in   The RGB color.
+		 * @param out  The four channels to send.
+		 */
+		void convert( const CRGB & in, RgbwPixel & out ) const
+		{
+			uint8_t  w;
+
+			if ( ! calibrated )
+			{
+				w = ( in.r < in.g ) ? in.r : in.g;
+				w = ( in.b < w ) ? in.b : w;
+
+				out.r = in.r - w;
+				out.g = in.g - w;
+				out.b = in.b - w;
+				out.w = w;
+				return;
+			}
+
+			uint32_t  level = ( (uint32_t) in.r * inverse[0] ) >> 8;
+			uint32_t  limit = ( (uint32_t) in.g * inverse[1] ) >> 8;
+
+			if ( limit < level )
+			{
+				level = limit;
+			}
+
+			limit = ( (uint32_t) in.b * inverse[2] ) >> 8;
+
+			if ( limit < level )
+			{
+				level = limit;
+			}
+
+			w = ( level > 255 ) ? 255 : (uint8_t) level;
+
+			out.r = qsub8( in.r, scale8( w, white.r ) );
+			out.g = qsub8( in.g, scale8( w, white.g ) );
+			out.b = qsub8( in.b, scale8( w, white.b ) );
+			out.w = w;
+		};
+};
+
+#endif /* RGBWCONVERTER_H_ */
@@ -0,0 +1,54 @@
+/*
+ * ShaderDevice.cpp
+ *
+ *  Created on: Oct 18, 2026
+ *      Author: Steven F. LeBrun
+ */
+
+#include "Clock.h"
+#include "PixelShader.h"
+#include "ShaderDevice.h"
+
+ShaderDevice::ShaderDevice( int nLEDs, int dPin ) :
+	LedDevice(nLEDs, dPin, NULL), shader(NULL), wire(dPin)
+{
+}
+
+ShaderDevice::~ShaderDevice()
+{
+}
+
+void ShaderDevice::show()
+{
+	unsigned long  start  = Clock::micros();
+	PixelShader *  source = NULL;
+	CRGB           color  = background;
+	int            i;
+
+	// Another light show may be using the device, for example to clear it.
+	if ( shader != NULL && LightShow::running() == shader )
+	{
+		source = shader;
+	}
+
+	for ( i = 0 ; i < maxLEDs ; ++i )
+	{
+		if ( source != NULL )
+		{
+			color = source->shade( i );
+		}
+
+		if ( level < 255 )
+		{
+			sendPixel( CRGB( color ).nscale8_video( level ) );
+		}
+		else
+		{
+			sendPixel( color );
+		}
+	}
+
+	Clock::delayMicroseconds( ShaderDevice_LATCH_US );
+
+	showTime.record( Clock::micros() - start );
+}
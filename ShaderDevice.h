@@ -0,0 +1,99 @@
+/**
+ * LED Device without a color array, for strips too long for the RAM of
+ * the board.  The colors are evaluated by a PixelShader while they are sent.
+ *
+ *  @date   Created on October 18, 2026
+ *  @author Steven F. LeBrun
+ *  <br/><br/>
+ */
+
+#ifndef SHADERDEVICE_H_
+#define SHADERDEVICE_H_
+
+#include "LedDevice.h"
+#include "NeoPixelWire.h"
+
+class PixelShader;
+
+/**
+ * The time, in microseconds, the data line is held low after the last LED
+ * unit so that the LED units latch the new colors.  Newer WS2812B LED units
+ * need more than the 50 microseconds of the original datasheet.
+ */
+#define  ShaderDevice_LATCH_US   300
+
+/**
+ * Class derived from LedDevice for a strip of WS2812B LED units that has
+ * no color array.  Instead of a FastLED controller it drives the data line
+ * itself, one LED unit at a time, asking the PixelShader for the color of
+ * each LED unit just before it is sent.  A 1000 LED unit strip costs the
+ * same few bytes of RAM as a 10 LED unit strip.
+ *
+ * Interrupts are turned off while the 24 bits of an LED unit are sent and
+ * turned back on between LED units, so millis() and the mode button keep
+ * working during a long frame.  The data line is low while the color of
+ * the next LED unit is evaluated; the whole frame takes the wire time plus
+ * the evaluation time of every LED unit.  The show() time in the
+ * LOG_PERF_OUTPUT record can be compared with the wire time in the
+ * LOG_PERF_DEVICE record to see how much the evaluation costs.
+ *
+ * The bit timing is written for an AVR at 16 MHz, @see NeoPixelWire.  On
+ * other boards the colors are evaluated but nothing is sent.
+ *
+ * The methods that set LED units, such as setLED() and advanceLEDs(), must
+ * not be used.  setLEDs() is ignored.  When the running light show is not
+ * its PixelShader the device sends the background color.
+ */
+class ShaderDevice: public LedDevice
+{
+	private:
+		/**
+		 * The light show that gives the colors, or NULL.
+		 */
+		PixelShader *       shader;
+
+		/**
+		 * The data line.
+		 */
+		NeoPixelWire        wire;
+
+	public:
+		/**
+		 * Constructor.
+		 *
+		 * @param nLEDs  The number of LED units on the strip.
+		 * @param dPin   The Arduino GPIO pin the data line is connected to.
+		 */
+		ShaderDevice( int nLEDs, int dPin );
+
+		/**
+		 * Destructor.
+		 */
+		virtual ~ShaderDevice();
+
+		/**
+		 * Sets the light show that gives the colors.  Called by
+		 * PixelShader::nextFrame().
+		 *
+		 * @param source  The light show.
+		 */
+		void setShader( PixelShader * source ) { shader = source; };
+
+		/**
+		 * Evaluates and sends the color of every LED unit, then holds the
+		 * data line low so the LED units latch the colors.  Below full
+		 * brightness each color is scaled to the output level as it is
+		 * sent, @see setBrightness().
+		 */
+		virtual void show();
+
+	private:
+		/**
+		 * Sends the color of one LED unit, green first.
+		 *
+		 * @param color  The color to send.
+		 */
+		void sendPixel( CRGB color ) { wire.send( color.g, color.r, color.b ); };
+};
+
+#endif /* SHADERDEVICE_H_ */
@@ -0,0 +1,90 @@
+/**
+ * Defines the byte code of the light show programs run by the ProgramShow
+ * class and built by the host side assembler, extras/ShowAssembler.cpp.
+ *
+ * This header does not depend on the Arduino or FastLED libraries so that
+ * it can be included by programs built with a normal host compiler.
+ *
+ * A program image, in flash or in EEPROM, has the following layout.
+ * Multi-byte values are stored least significant byte first.
+ *
+ *    Byte 0       ShowProgram_MAGIC, marks a valid image.
+ *    Bytes 1..2   The number of bytes of code that follow.
+ *    Bytes 3..    The code.
+ *
+ * Each instruction is an opcode, one of the ShowOp values, followed by its
+ * operands.  The comment for each opcode lists them, where:
+ *
+ *    r     is a register number, [0..ShowProgram_REGISTERS);
+ *    n     is an unsigned byte;
+ *    imm   is a signed 16 bit value;
+ *    addr  is the offset of an instruction from the start of the code;
+ *    rgb   is a color, as red, green and blue bytes.
+ *
+ * The registers are signed 16 bit values.  They keep their values when the
+ * program is started again, so a sketch can use them as parameters of the
+ * program, @see ProgramShow::setRegister().
+ *
+ *  @date   Created on October 18, 2026
+ *  @author Steven F. LeBrun
+ *  <br/><br/>
+ */
+
+#ifndef SHOWPROGRAMFORMAT_H_
+#define SHOWPROGRAMFORMAT_H_
+
+/**
+ * The value of the first byte of a program image.
+ */
+#define  ShowProgram_MAGIC        0xB5
+
+/**
+ * The number of bytes in a program image before the code.
+ */
+#define  ShowProgram_HEADER_SIZE  3
+
+/**
+ * The number of registers.  Must be a power of two.
+ */
+#define  ShowProgram_REGISTERS    8
+
+/**
+ * The number of values the stack holds.
+ */
+#define  ShowProgram_STACK        4
+
+/**
+ * The opcodes of the byte code.
+ *
+ * New opcodes must be added to the end of the list so that programs
+ * already in EEPROM still run.  The assembler has its own table of names
+ * and must be updated when an opcode is added.
+ */
+enum ShowOp
+{
+	OP_END      = 0,   ///< Ends the light show: no operands.
+	OP_WAIT     = 1,   ///< Ends the frame and shows it for a number of frames: n.
+	OP_FILL     = 2,   ///< Sets every LED unit to a color: rgb.
+	OP_FILL_FG  = 3,   ///< Sets every LED unit to the foreground color: no operands.
+	OP_FILL_BG  = 4,   ///< Sets every LED unit to the background color: no operands.
+	OP_SET      = 5,   ///< Sets the LED unit in a register to a color: r, rgb.
+	OP_SET_FG   = 6,   ///< Sets the LED unit in a register to the foreground color: r.
+	OP_SET_BG   = 7,   ///< Sets the LED unit in a register to the background color: r.
+	OP_ADVANCE  = 8,   ///< Moves the colors one LED unit up the device: no operands.
+	OP_RETREAT  = 9,   ///< Moves the colors one LED unit down the device: no operands.
+	OP_PALETTE  = 10,  ///< Sets the LED unit in the first register to the palette color at the second: r, r.
+	OP_RANDOM   = 11,  ///< Sets the first register to a random value below the second: r, r.
+	OP_LOAD     = 12,  ///< Sets a register to a value: r, imm.
+	OP_ADD      = 13,  ///< Adds a value to a register: r, imm.
+	OP_ADD_REG  = 14,  ///< Adds the second register to the first: r, r.
+	OP_SUB_REG  = 15,  ///< Subtracts the second register from the first: r, r.
+	OP_MOVE     = 16,  ///< Copies the second register to the first: r, r.
+	OP_LEDS     = 17,  ///< Sets a register to the number of LED units: r.
+	OP_LOOP     = 18,  ///< Takes one from a register and jumps if it is still above zero: r, addr.
+	OP_JUMP     = 19,  ///< Jumps: addr.
+	OP_PUSH     = 20,  ///< Pushes a register onto the stack: r.
+	OP_POP      = 21,  ///< Pops the stack into a register: r.
+	OP_OPCODES  = 22   ///< The number of opcodes, not an opcode.
+};
+
+#endif /* SHOWPROGRAMFORMAT_H_ */
@@ -6,7 +6,7 @@
  */
 
 #include "Colors.h"
-#include "Interrupts.h"
+#include "EventLog.h"
 #include "SparkleLEDs.h"
 
 /**
@@ -15,7 +15,7 @@
 const int SparkleLEDs::SPARKLE_DELAY = 100;
 
 SparkleLEDs::SparkleLEDs(LedDevice * dLEDs ) :
-	LightShow(dLEDs)
+	LightShow(dLEDs, SPARKLE_DELAY)
 {
 
 }
@@ -25,26 +25,12 @@ SparkleLEDs::~SparkleLEDs()
 
 }
 
-void SparkleLEDs::display()
+bool SparkleLEDs::nextFrame()
 {
-	// Start the LED Device with just the default background color set.
-	device->showBackground();
-	CHECK_MODE_CHANGE;
+	// Fewer sparkles when the frame governor has reduced the quality.
+	setColors( ( quality == QUALITY_FULL ) ? 80 : 40 );
 
-	// Infinite Loop.  Exit when Change Mode Interrupt occurs.
-	//Serial.println("Entering infinite Sparkle Loop");
-	for ( ; ; )
-	{
-		CHECK_MODE_CHANGE;
-
-		setColors( 80 );
-		device->getDevice()->show();
-
-		// Exits loop if Mode Change Interrupt has occurred.
-		CHECK_MODE_CHANGE;
-
-		delay( SPARKLE_DELAY );
-	}
+	return true;
 }
 
 void SparkleLEDs::setColors( long percent )
@@ -52,11 +38,9 @@ void SparkleLEDs::setColors( long percent )
 	int  i;
 	int  min     = 0;
 	int  max     = 101;
+	int  changed = 0;
 	long rNum;
 
-//	Serial.println("Entering setColor()");
-
-	CRGB leds    = device->getLEDs();
 	int  maxLEDs = device->numberOfLEDs();
 
 	for ( i = 0 ; i < maxLEDs ; ++i )
@@ -66,9 +50,12 @@ void SparkleLEDs::setColors( long percent )
 		if ( percent >= rNum )
 		{
 			device->setLED(i, Colors::randomJustColor());
+			++changed;
 		}
 	}
 
+	EventLog::log( LOG_SPARKLE, changed );
+
 	return;
 
 }   // end of SparkleLEDs::setColors()
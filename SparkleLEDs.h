@@ -48,16 +48,22 @@ class SparkleLEDs: public LightShow
 		virtual ~SparkleLEDs();
 
 		/**
-		 * The actual Light Show controls.  This method runs in an infinite
-		 * loop only exiting when a Mode Change Interrupt has been detected.
+		 * The actual Light Show controls.  The light show runs forever, only
+		 * exiting when a Mode Change Interrupt has been detected.
 		 *
-		 * Each iteration of the loop starts with setting each LED Unit to a
-		 * new random color and then showing the new values.  There is a
+		 * Each frame sets each LED Unit to a new random color.  There is a
 		 * percent value used to determine what percentage of the time the
 		 * LED Unit changes color or stays the same.  This percentage is
 		 * hardcoded into this method.
+		 *
+		 * @return Always returns @b true.
+		 */
+		virtual bool nextFrame();
+
+		/**
+		 * @return Returns SHOW_SPARKLE.
 		 */
-		virtual void display();
+		virtual uint8_t getShowType() { return SHOW_SPARKLE; };
 
 	private:
 		/**
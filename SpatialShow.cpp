@@ -0,0 +1,129 @@
+/*
+ * SpatialShow.cpp
+ *
+ *  Created on: Oct 18, 2026
+ *      Author: Steven F. LeBrun
+ */
+
+#include "Clock.h"
+#include "Colors.h"
+#include "SpatialShow.h"
+
+SpatialShow::SpatialShow( LedDevice * dLEDs, const uint8_t * palette ) :
+	MultiDeviceShow(dLEDs, SpatialShow_DELAY), effect(SPATIAL_PLANE_WAVE), palette(palette),
+	directionX(0), directionY(0), centreX(0), centreY(0), scale(0), rate(0), phase(0), lastTime(0)
+{
+	setPlaneWave( 0, 250, 250 );
+}
+
+SpatialShow::~SpatialShow()
+{
+}
+
+bool SpatialShow::addDevice( LedDevice * dLEDs )
+{
+	if ( ! dLEDs->hasCoordinates() )
+	{
+		return false;
+	}
+
+	return MultiDeviceShow::addDevice( dLEDs );
+}
+
+void SpatialShow::setWave( uint16_t wavelength, uint16_t speed )
+{
+	if ( wavelength == 0 )
+	{
+		wavelength = 1;
+	}
+
+	// One wavelength is 256 palette positions, kept in 1/256ths.
+	scale = 65535UL / wavelength;
+	rate  = ( 65536UL * speed ) / ( 1000UL * wavelength );
+}
+
+void SpatialShow::setPlaneWave( uint8_t angle, uint16_t wavelength, uint16_t speed )
+{
+	effect     = SPATIAL_PLANE_WAVE;
+	directionX = cos16( (uint16_t) angle << 8 );
+	directionY = sin16( (uint16_t) angle << 8 );
+
+	setWave( wavelength, speed );
+}
+
+void SpatialShow::setRadialPulse( int16_t x, int16_t y, uint16_t wavelength, uint16_t speed )
+{
+	effect  = SPATIAL_RADIAL_PULSE;
+	centreX = x * LedDevice_UNITS_PER_MM;
+	centreY = y * LedDevice_UNITS_PER_MM;
+
+	setWave( wavelength, speed );
+}
+
+void SpatialShow::start()
+{
+	phase    = 0;
+	lastTime = Clock::millis();
+}
+
+void SpatialShow::resume()
+{
+	lastTime = Clock::millis();
+}
+
+bool SpatialShow::nextFrame()
+{
+	unsigned long  now = Clock::millis();
+	uint8_t        d;
+	int            i;
+
+	// The wave moves away from the origin, or the centre, so the phase
+	// at a fixed point falls over time.
+	phase   += ( now - lastTime ) * rate;
+	lastTime = now;
+
+	for ( d = 0 ; d < nDevices ; ++d )
+	{
+		LedDevice *  dLEDs   = devices[d];
+		CRGB *       leds    = dLEDs->getLEDs();
+		int          maxLEDs = dLEDs->numberOfLEDs();
+
+		for ( i = 0 ; i < maxLEDs ; ++i )
+		{
+			int16_t  x = dLEDs->getX( i );
+			int16_t  y = dLEDs->getY( i );
+			long     distance;
+
+			if ( effect == SPATIAL_PLANE_WAVE )
+			{
+				// The distance along the direction of travel.
+				distance = ( (long) x * directionX + (long) y * directionY ) >> 15;
+			}
+			else
+			{
+				// The largest plus 3/8 of the smallest is within 7% of the
+				// true distance, without squares or a square root.
+				uint16_t  dx = ( x > centreX ) ? x - centreX : centreX - x;
+				uint16_t  dy = ( y > centreY ) ? y - centreY : centreY - y;
+
+				distance = ( dx > dy ) ? dx + ( ( 3 * (long) dy ) >> 3 )
+				                       : dy + ( ( 3 * (long) dx ) >> 3 );
+			}
+
+			// To millimetres, then to a position in the palette.
+			uint8_t  position = (uint8_t) ( ( ( distance / LedDevice_UNITS_PER_MM ) * scale
+			                                  - phase ) >> 8 );
+
+			leds[i] = Colors::paletteColor( palette, position );
+
+			if ( effect == SPATIAL_RADIAL_PULSE )
+			{
+				leds[i].nscale8( quadwave8( position ) );
+			}
+		}
+
+		dLEDs->setChanged();
+	}
+
+	return true;
+}
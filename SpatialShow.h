@@ -0,0 +1,168 @@
+/**
+ * Light Show that evaluates an effect over the physical positions of the
+ * LED units of one or more LED Devices.
+ *
+ *  @date   Created on October 18, 2026
+ *  @author Steven F. LeBrun
+ *  <br/><br/>
+ */
+
+#ifndef SPATIALSHOW_H_
+#define SPATIALSHOW_H_
+
+#include "LedDevice.h"
+#include "MultiDeviceShow.h"
+
+/**
+ * The time, in milliseconds, between frames.
+ */
+#define  SpatialShow_DELAY        20
+
+/**
+ * The effects a SpatialShow can evaluate.
+ */
+enum SpatialEffect
+{
+	SPATIAL_PLANE_WAVE   = 0,   ///< Bands of color that travel across space in one direction.
+	SPATIAL_RADIAL_PULSE = 1    ///< Rings of light that spread out from a centre point.
+};
+
+/**
+ * Light Show derived class that colors each LED unit by where it is rather
+ * than by its offset, so that an effect passes through every device in
+ * the same space as one picture.  Each device must know the positions of
+ * its LED units, @see LedDevice::setCoordinates().
+ *
+ * The position of each LED unit is read from flash and the effects are
+ * evaluated with integer math: a plane wave projects the position onto the
+ * direction of travel with sin16() and cos16(), and a radial pulse uses an
+ * estimate of the distance from the centre that needs no square root.  The
+ * phase of the wave picks a color from a gradient palette.
+ *
+ * The render time in the LOG_PERF_RENDER record covers every LED unit of
+ * every device.
+ */
+class SpatialShow: public MultiDeviceShow
+{
+	private:
+		/**
+		 * One of the SpatialEffect values.
+		 */
+		uint8_t         effect;
+
+		/**
+		 * The palette in flash that the phase is looked up in.
+		 */
+		const uint8_t * palette;
+
+		/**
+		 * The direction of travel of the plane wave, as a unit vector in
+		 * 1/32768ths.
+		 */
+		int16_t         directionX;
+		int16_t         directionY;
+
+		/**
+		 * The centre of the radial pulse in coordinate units.
+		 */
+		int16_t         centreX;
+		int16_t         centreY;
+
+		/**
+		 * The phase change per millimetre, in 1/256ths of a palette position.
+		 */
+		uint16_t        scale;
+
+		/**
+		 * The phase change per millisecond, in 1/256ths of a palette position.
+		 */
+		uint16_t        rate;
+
+		/**
+		 * The phase of the wave at the origin, in 1/256ths of a palette position.
+		 */
+		uint16_t        phase;
+
+		/**
+		 * The millis() value of the last frame.
+		 */
+		unsigned long   lastTime;
+
+	public:
+		/**
+		 * Constructor.  The effect starts as a plane wave moving to the
+		 * right with a wavelength of 250 mm at 250 mm per second.
+		 *
+		 * @param dLEDs    Pointer to the first LED Device to be used.
+		 * @param palette  A palette in flash, such as Colors::RAINBOW_PALETTE.
+		 */
+		SpatialShow( LedDevice * dLEDs, const uint8_t * palette );
+
+		/**
+		 * Destructor.  The devices are owned by the creator of this object.
+		 */
+		virtual ~SpatialShow();
+
+		/**
+		 * Adds another device to render onto.
+		 *
+		 * @param dLEDs  The device.  It must know the positions of its LED units.
+		 * @return Returns @b false if there is no room for another device or
+		 *         the positions of its LED units are not known.
+		 */
+		virtual bool addDevice( LedDevice * dLEDs );
+
+		/**
+		 * Makes the effect a plane wave.
+		 *
+		 * @param angle       The direction of travel, clockwise from the
+		 *                    x axis, in 1/256ths of a turn.
+		 * @param wavelength  The distance, in millimetres, over which the
+		 *                    palette repeats.
+		 * @param speed       The speed of the wave in millimetres per second.
+		 */
+		void setPlaneWave( uint8_t angle, uint16_t wavelength, uint16_t speed );
+
+		/**
+		 * Makes the effect a radial pulse.
+		 *
+		 * @param x           The x position of the centre in millimetres.
+		 * @param y           The y position of the centre in millimetres.
+		 * @param wavelength  The distance, in millimetres, between pulses.
+		 * @param speed       The speed the pulses spread out at in
+		 *                    millimetres per second.
+		 */
+		void setRadialPulse( int16_t x, int16_t y, uint16_t wavelength, uint16_t speed );
+
+		/**
+		 * Starts the wave at phase zero.
+		 */
+		virtual void start();
+
+		/**
+		 * Restarts the clock so the wave does not jump by the time spent
+		 * suspended.  Every LED unit is set on every frame, so nothing has
+		 * to be repainted.
+		 */
+		virtual void resume();
+
+		/**
+		 * Sets every LED unit of every device from the effect.
+		 *
+		 * @return Always returns @b true.
+		 */
+		virtual bool nextFrame();
+
+		/**
+		 * @return Returns SHOW_SPATIAL.
+		 */
+		virtual uint8_t getShowType() { return SHOW_SPATIAL; };
+
+	private:
+		/**
+		 * Sets the scale and rate from a wavelength and speed.
+		 */
+		void setWave( uint16_t wavelength, uint16_t speed );
+};
+
+#endif /* SPATIALSHOW_H_ */
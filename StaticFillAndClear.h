@@ -0,0 +1,124 @@
+/**
+ * Template version of FillAndClear whose colors are chosen without virtual
+ * calls.
+ *
+ *  @date   Created on October 18, 2026
+ *  @author Steven F. LeBrun
+ *  <br/><br/>
+ */
+
+#ifndef STATICFILLANDCLEAR_H_
+#define STATICFILLANDCLEAR_H_
+
+#include "FillAndClear.h"
+#include "StaticLightShow.h"
+
+/**
+ * The same light show as FillAndClear, @see FillAndClear, with nextColor()
+ * supplied by the derived class as a non-virtual method.  The derived class
+ * passes its own type as the Show parameter and defines:
+ *
+ *     CRGB nextColor( int led );
+ *
+ * frame() moves the colors along and sets the first LED unit through the
+ * color array of the device, so the move, the call to nextColor() and the
+ * store are all inlined into one loop.  Like advanceLEDs(), the LED units
+ * move towards the end of the device.  Because the array is written
+ * directly, the setLED() counter of the device is not updated.
+ */
+template <class Show>
+class StaticFillAndClear: public StaticLightShow<Show>
+{
+	protected:
+		/**
+		 * The number of LED Units in the LED Device.
+		 */
+		int  maxLEDs;
+
+		/**
+		 * The number of frames rendered since the light show started.  This
+		 * is the value passed to nextColor().  Legal range [0 .. 2*maxLEDs].
+		 */
+		int  step;
+
+	public:
+		/**
+		 * Constructor.
+		 *
+		 * @param dLED  Pointer to the LED Device to be operated on by this
+		 *              object.
+		 */
+		StaticFillAndClear( LedDevice * dLED ) :
+			StaticLightShow<Show>(dLED, FillAndClear_FILL_DELAY), maxLEDs(dLED->numberOfLEDs()), step(0)
+		{
+		}
+
+		/**
+		 * Destructor.
+		 */
+		virtual ~StaticFillAndClear()
+		{
+		}
+
+		/**
+		 * Restarts the fill from the first step.
+		 */
+		virtual void start()
+		{
+			step = 0;
+		}
+
+		/**
+		 * Repaints the LED Units for the current step, @see FillAndClear::resume().
+		 */
+		virtual void resume()
+		{
+			CRGB *  leds = this->device->getLEDs();
+
+			for ( int i = 0 ; i < maxLEDs ; ++i )
+			{
+				int  k = step - 1 - i;
+
+				leds[i] = ( k >= 0 ) ? static_cast<Show *>(this)->nextColor( k )
+				                     : this->device->getBackground();
+			}
+
+			this->device->setChanged();
+		}
+
+		/**
+		 * Renders one step of the light show.  It will advance the LED Unit
+		 * color values and set the first LED Unit to the color provided by
+		 * nextColor() of the derived class.
+		 *
+		 * @return Returns @b false once all 2*maxLEDs steps have been shown.
+		 */
+		bool frame()
+		{
+			if ( step >= 2*maxLEDs )
+			{
+				return false;
+			}
+
+			CRGB *  leds = this->device->getLEDs();
+
+			for ( int i = maxLEDs - 1 ; i > 0 ; --i )
+			{
+				leds[i] = leds[i - 1];
+			}
+
+			leds[0] = static_cast<Show *>(this)->nextColor( step );
+			this->device->setChanged();
+
+			++step;
+
+			return true;
+		}
+
+		/**
+		 * @return Returns SHOW_FILL_AND_CLEAR.
+		 */
+		virtual uint8_t getShowType() { return SHOW_FILL_AND_CLEAR; };
+};
+
+#endif /* STATICFILLANDCLEAR_H_ */
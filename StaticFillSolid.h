@@ -0,0 +1,79 @@
+/**
+ * Template based version of the FillSolid light show.
+ *
+ *  @date   Created on October 18, 2026
+ *  @author Steven F. LeBrun
+ *  <br/><br/>
+ */
+
+#ifndef STATICFILLSOLID_H_
+#define STATICFILLSOLID_H_
+
+#include "StaticFillAndClear.h"
+
+/**
+ * The same light show as FillSolid, built on StaticFillAndClear so that
+ * nextColor() is inlined into each frame.  @see FillSolid
+ */
+class StaticFillSolid: public StaticFillAndClear<StaticFillSolid>
+{
+	private:
+		/**
+		 * The default foreground color to use.
+		 */
+		CRGB  foreground;
+
+		/**
+		 * The default background color to use.
+		 */
+		CRGB  background;
+
+	public:
+		/**
+		 * Constructor.
+		 *
+		 * @param fColor The foreground color to use.
+		 * @param bColor The background color to use.
+		 * @param dLED   Pointer to the LED Device to use.
+		 */
+		StaticFillSolid( CRGB fColor, CRGB bColor, LedDevice * dLED ) :
+			StaticFillAndClear<StaticFillSolid>(dLED), foreground(fColor), background(bColor)
+		{
+		}
+
+		/**
+		 * Destructor.
+		 */
+		virtual ~StaticFillSolid()
+		{
+		}
+
+		/**
+		 * Provides the color for the first LED Unit of each step.
+		 *
+		 * @param led  The number of steps rendered so far, [0 .. 2*maxLEDs).
+		 *
+		 * @return Returns the foreground color for the first maxLEDs steps
+		 *         and the background color for the rest.
+		 */
+		CRGB nextColor( int led )
+		{
+			return ( led < maxLEDs ) ? foreground : background;
+		}
+
+		/**
+		 * Changes the foreground color.  Does not change any LED Unit.
+		 *
+		 * @param fColor The new foreground color to use.
+		 */
+		void setForeground( CRGB fColor ) { foreground = fColor; };
+
+		/**
+		 * Changes the background color.  Does not change any LED Unit.
+		 *
+		 * @param bColor The new background color to use.
+		 */
+		void setBackground( CRGB bColor ) { background = bColor; };
+};
+
+#endif /* STATICFILLSOLID_H_ */
@@ -0,0 +1,90 @@
+/**
+ * Template base class for light shows whose frames are rendered without
+ * virtual calls.
+ *
+ *  @date   Created on October 18, 2026
+ *  @author Steven F. LeBrun
+ *  <br/><br/>
+ */
+
+#ifndef STATICLIGHTSHOW_H_
+#define STATICLIGHTSHOW_H_
+
+#include "LedDevice.h"
+#include "LightShow.h"
+
+/**
+ * Template base class that uses the Curiously Recurring Template Pattern
+ * to give a light show two ways in.
+ *
+ * The derived class provides a non-virtual frame() method, passing its own
+ * type as the Show parameter:
+ *
+ *     class MyShow: public StaticLightShow<MyShow>
+ *     {
+ *         public:
+ *             bool frame() { ... }
+ *     };
+ *
+ * Code that knows the type of the show calls frame() directly, and the
+ * compiler can inline it along with everything it calls.  nextFrame() is
+ * a thin virtual wrapper around frame() so the show can still be selected
+ * at run time and run by LightShow::display() like any other light show.
+ * Either way there is at most one virtual call per frame; the work done
+ * for each LED unit inside a frame has no virtual calls.
+ */
+template <class Show>
+class StaticLightShow: public LightShow
+{
+	public:
+		/**
+		 * Constructor.
+		 *
+		 * @param dLEDs  A pointer to the LED Device that this instance works on.
+		 * @param fDelay The time, in milliseconds, from the start of one frame
+		 *               to the start of the next.
+		 */
+		StaticLightShow( LedDevice * dLEDs, unsigned long fDelay = 50 ) :
+			LightShow(dLEDs, fDelay)
+		{
+		}
+
+		/**
+		 * Destructor.
+		 */
+		virtual ~StaticLightShow()
+		{
+		}
+
+		/**
+		 * Forwards to the frame() method of the derived class.
+		 *
+		 * @return Returns the value returned by frame().
+		 */
+		virtual bool nextFrame()
+		{
+			return static_cast<Show *>(this)->frame();
+		}
+
+		/**
+		 * Renders frames without going through nextFrame(), restarting the
+		 * show whenever it finishes.  Used to measure the cost of a frame
+		 * without the virtual call.
+		 *
+		 * @param n  The number of frames to render.
+		 */
+		void frames( unsigned long n )
+		{
+			Show *  show = static_cast<Show *>(this);
+
+			for ( ; n > 0 ; --n )
+			{
+				if ( ! show->frame() )
+				{
+					show->start();
+				}
+			}
+		}
+};
+
+#endif /* STATICLIGHTSHOW_H_ */
@@ -8,23 +8,40 @@
 #include <Arduino.h>
 #include <FastLED.h>
 
+#include "AudioShow.h"
+#include "Benchmark.h"
+#include "BufferDevice.h"
+#include "Clock.h"
 #include "Colors.h"
+#include "Compositor.h"
+#include "EventLog.h"
+#include "FillSolidShader.h"
 #include "Interrupts.h"
 #include "LedRing.h"
 #include "LedStrip.h"
-
-#include "FillSolid.h"
+#include "PaletteShow.h"
+#include "ParticleSparkle.h"
+#include "ProgramShow.h"
+#include "ShaderDevice.h"
 #include "SparkleLEDs.h"
+#include "SpatialShow.h"
+#include "StaticFillSolid.h"
 #include "Sweeper.h"
+#include "SweeperShader.h"
 
 #define  INTR_PIN     2
 #define  INTR         INT0
 
 #define  STRIP_DATA_PIN  6
 #define  RING_DATA_PIN   5
+#define  LONG_DATA_PIN   8
+#define  LONG_STRIP_SIZE 1200
 #define  UNUSED_PIN      0
+#define  AUDIO_PIN       A1
+#define  FADE_MS         300   // Fade between light shows, @see LedDevice::setFadeTime()
+#define  STACK_PAINT     0xA5  // Fills free RAM at boot, @see report_memory()
 
-volatile unsigned long  lastTime = millis();
+volatile unsigned long  lastTime = Clock::millis();
 unsigned long           deltaTime = 500;  // .5 seconds
 
 // Modes:
@@ -37,19 +54,75 @@ unsigned long           deltaTime = 500;  // .5 seconds
 //  6  == Sweeper Ring - infinite, one set of colors
 //  7  == Sparkle Strip
 //  8  == Sparkle Ring
-//  9  == Default: Flash Full
+//  9  == Smooth Sweeper Ring - infinite, sub-LED motion
+// 10  == Sparkles over Smooth Sweeper Ring - two composited layers
+// 11  == Rainbow Strip - moving color wheel at 100 frames per second
+// 12  == Heat Palette Ring
+// 13  == Particle Sparkles Strip - sparkles that fade away
+// 14  == Plane Wave - rainbow bands moving through the strip and the ring
+// 15  == Radial Pulse - rings spreading out from the ring along the strip
+// 16  == Long Sweeper - infinite, on the 1200 LED strip without a color array
+// 17  == Long Fill and Empty - on the 1200 LED strip without a color array
+// 18  == Music - the strip and the ring flash on the beat from the audio pin
+// 19  == Program - the light show loaded into EEPROM by the l command, or a sweeper
+// 20  == Default: Flash Full
 //
 
-#define  MAX_MODES       9
+#define  MAX_MODES      20
 
 volatile bool  mode_change = false;
 volatile int   mode        = 0;
 
+/**
+ * Set by the @b t command.  While set, every edge seen by ModeInterrupt()
+ * is written to the event log, bounces included, so that a capture can be
+ * turned into a trace and replayed on a host.  @see extras/TraceReplay.cpp
+ */
+volatile bool  trace_button = false;
+
 int last_mode = -1;
 
 LedRing   ring;
 LedStrip  strip;
 
+/**
+ * The back buffer of the ring.  Light shows render into it while the ring
+ * sends the previous frame; @see LedDevice::setBackBuffer().
+ */
+CRGB      ringBack[LedRing_RING_SIZE];
+
+/**
+ * A long strip driven without a color array.  Its light shows are pixel
+ * shaders, @see PixelShader, so it costs a few bytes of RAM however long
+ * it is.
+ */
+ShaderDevice  longStrip( LONG_STRIP_SIZE, LONG_DATA_PIN );
+
+// Light shows of the modes whose state is worth coming back to.  Each one
+// is built once, here, so a mode that is returned to resumes its sweep or
+// fill where it was suspended.  @see LightShow::resume()
+//
+// Every light show costs RAM for its counters as well as its state, and an
+// Arduino Uno has 2 KB.  The light shows of the other modes are random,
+// scroll from wherever they start or keep buffers, so they are built when
+// their mode starts, as before, and only take stack while it runs.
+
+StaticFillSolid  stripSolid( CRGB::White, CRGB::Black, &strip );
+StaticFillSolid  ringSolid( CRGB::White, CRGB::Black, &ring );
+Sweeper          stripSweep( &strip );
+Sweeper          stripInfinite( &strip );
+Sweeper          ringSweep( &ring );
+Sweeper          ringInfinite( &ring );
+
+// The color cursors of the modes that change color each time their light
+// show finishes.  Kept with the light shows so the colors carry on too.
+
+Colors  stripSolidColors;
+Colors  ringSolidColors;
+Colors  stripSweepColors;
+Colors  ringSweepColors;
+Colors  longFillColors;
+
 /**
  * Interrupt Method
  *
@@ -60,9 +133,17 @@ LedStrip  strip;
 void ModeInterrupt()
 {
 	// Attempting to debounce button to prevent false mode changes
-	unsigned long  nowTime = millis();
+	unsigned long  nowTime = Clock::millis();
+	bool           bounce  = ( nowTime < ( lastTime + deltaTime ) );
+
+	if ( trace_button )
+	{
+		uint16_t  args[] = { (uint16_t) nowTime, (uint16_t) ( nowTime >> 16 ), (uint16_t) mode, ! bounce };
+
+		EventLog::write( LOG_BUTTON, 4, args );
+	}
 
-	if ( nowTime < ( lastTime + deltaTime ) )
+	if ( bounce )
 	{
 		// This is a bounce
 		return;
@@ -87,6 +168,152 @@ void ModeInterrupt()
 
 }   // end of ModeInterrupt()
 
+#if defined(__AVR__)
+// Kept by the AVR C library: the end of the globals and the end of the heap.
+extern char    __heap_start;
+extern char *  __brkval;
+#endif
+
+/**
+ * Fills the free RAM between the heap and the stack with STACK_PAINT, so
+ * that report_memory() can tell how deep the stack has reached.  Called
+ * first in setup().
+ */
+void paint_memory()
+{
+#if defined(__AVR__)
+	uint8_t    here;
+	uint8_t *  p = (uint8_t *) ( ( __brkval != NULL ) ? __brkval : &__heap_start );
+
+	// Leave room for the frame of this function.
+	while ( p < &here - 16 )
+	{
+		*p++ = STACK_PAINT;
+	}
+#endif
+}
+
+/**
+ * Writes a LOG_MEMORY record with the free RAM between the heap and the
+ * stack now and the least there has been since boot: the paint left by
+ * paint_memory() that the stack has never reached.  The benchmarks take
+ * their buffers from the heap, so after the @b b command the least free
+ * RAM reads low until the next boot.
+ */
+void report_memory()
+{
+#if defined(__AVR__)
+	uint8_t    here;
+	uint8_t *  heapEnd = (uint8_t *) ( ( __brkval != NULL ) ? __brkval : &__heap_start );
+	uint8_t *  p       = heapEnd;
+
+	while ( p < &here && *p == STACK_PAINT )
+	{
+		++p;
+	}
+
+	EventLog::log( LOG_MEMORY, (uint16_t) ( &here - heapEnd ), (uint16_t) ( p - heapEnd ) );
+#endif
+}
+
+/**
+ * Writes the performance counters of the running light show and of every
+ * LED Device to the event log, and the free RAM.
+ */
+void report_counters()
+{
+	LightShow * show = LightShow::running();
+	LedDevice * dev;
+
+	if ( show != NULL )
+	{
+		show->report();
+		EventLog::flush();
+	}
+
+	for ( dev = LedDevice::firstDevice() ; dev != NULL ; dev = dev->nextDevice() )
+	{
+		dev->report();
+		EventLog::flush();
+	}
+
+	report_memory();
+}
+
+/**
+ * Sets the performance counters of the running light show and of every
+ * LED Device back to zero.
+ */
+void reset_counters()
+{
+	LightShow * show = LightShow::running();
+	LedDevice * dev;
+
+	if ( show != NULL )
+	{
+		show->resetCounters();
+	}
+
+	for ( dev = LedDevice::firstDevice() ; dev != NULL ; dev = dev->nextDevice() )
+	{
+		dev->resetCounters();
+	}
+}
+
+/**
+ * Handles single character commands sent over the serial port.
+ *
+ *   b  Run the benchmarks.
+ *   l  Load a light show program into EEPROM, @see ProgramShow::receive().
+ *   p  Report the performance counters.
+ *   r  Reset the performance counters.
+ *   t  Turn tracing of the mode button on or off.
+ */
+void check_commands()
+{
+	if ( Serial.available() <= 0 )
+	{
+		return;
+	}
+
+	switch ( Serial.read() )
+	{
+		case 'b':
+			Benchmark::run();
+			break;
+
+		case 'l':
+			ProgramShow::receive();
+			break;
+
+		case 'p':
+			report_counters();
+			break;
+
+		case 'r':
+			reset_counters();
+			break;
+
+		case 't':
+			trace_button = ! trace_button;
+			break;
+
+		default:
+			break;
+	}
+}
+
+/**
+ * Called by the Arduino core while delay() is waiting.  Replaces the empty
+ * default so that queued log records are sent and serial commands are
+ * handled while the light shows wait between frames.
+ */
+void yield()
+{
+	EventLog::service();
+	check_commands();
+}
+
 void clear_all()
 {
 	ring.getDevice()->clear();
@@ -94,6 +321,9 @@ void clear_all()
 
 	strip.getDevice()->clear();
 	strip.getDevice()->show();
+
+	// Not a FastLED controller, so it is cleared by sending its background.
+	longStrip.show();
 }
 
 /**
@@ -107,61 +337,177 @@ void clear_all()
 void  mode_off()
 {
 	clear_all();
-	delay(1000);
+	Clock::delay(1000);
 }
 
-void mode_solid( LedDevice * dLEDs )
+/**
+ * Sets the number of foreground LED units and the cycles of the sweeps.
+ * Called once from setup().
+ */
+void configure_shows()
 {
-	Colors     colors;
-	FillSolid  solid(CRGB::White, CRGB::Black, dLEDs);
+	stripSweep.setNumLEDs( 10 );
+	stripSweep.setCycles( 4 );
 
-	dLEDs->setBackground( CRGB::Black );
+	stripInfinite.setNumLEDs( 10 );
+	stripInfinite.setCycles( 0 );
+
+	ringSweep.setNumLEDs( 3 );
+	ringSweep.setCycles( 4 );
+
+	ringInfinite.setNumLEDs( 3 );
+	ringInfinite.setCycles( 0 );
+
+	longStrip.setBackground( CRGB::Black );
+	longStrip.setForeground( CRGB::Purple );
+}
+
+void mode_solid( StaticFillSolid & solid, Colors & colors )
+{
+	solid.getLedDevice()->setBackground( CRGB::Black );
 
 	for ( ; ; )
 	{
-		solid.setForeground(colors.nextColor());
+		// A resumed fill keeps the color it was suspended with.
+		if ( ! solid.isSuspended() )
+		{
+			solid.setForeground(colors.nextColor());
+		}
+
 		solid.run();
 		CHECK_MODE_CHANGE;
 	}
 }
 
+void mode_longFill( Colors & colors )
+{
+	FillSolidShader  fill( CRGB::White, CRGB::Black, &longStrip );
+
+	for ( ; ; )
+	{
+		fill.setForeground(colors.nextColor());
+		fill.run();
+		CHECK_MODE_CHANGE;
+	}
+}
 
-void mode_sweeper( LedDevice * dLEDs, int nLEDs, int cycles )
+void mode_longSweep()
 {
-	Colors  color;
+	SweeperShader  sweep( &longStrip );
 
-	dLEDs->setBackground( CRGB::Black );
+	sweep.setNumLEDs( 50 );
+	sweep.setCycles( 0 );
 
-	Sweeper  sweep(dLEDs);
+	sweep.run();
+}
 
-	sweep.setNumLEDs(nLEDs);
-	sweep.setCycles(cycles);
+void mode_sweeper( Sweeper & sweep, Colors & colors )
+{
+	LedDevice * dLEDs = sweep.getLedDevice();
+
+	dLEDs->setBackground( CRGB::Black );
 
 	for ( ; ; )
 	{
-		dLEDs->setForeground( color.nextColor() );
+		dLEDs->setForeground( sweep.isSuspended() ? colors.currentColor() : colors.nextColor() );
 		sweep.run();
 		CHECK_MODE_CHANGE;
 	}
 }
 
-void mode_iSweep(LedDevice * dLEDs, CRGB fColor, CRGB bColor, int nLEDs)
+void mode_iSweep( Sweeper & sweep, CRGB fColor, CRGB bColor )
 {
+	LedDevice * dLEDs = sweep.getLedDevice();
+
 	dLEDs->setBackground( bColor );
 	dLEDs->setForeground( fColor );
 
-	Sweeper   sweep( dLEDs );
+	for ( ; ; )
+	{
+		sweep.run();
+		CHECK_MODE_CHANGE;
+	}
+}
+
+/**
+ * Sweeps the foreground LED units at a fixed speed with the ends blended
+ * between LED units.  @see Sweeper::setSmooth()
+ *
+ * @param speed  LED units per second as an 8.8 fixed point number.
+ */
+void mode_smoothSweep( LedDevice * dLEDs, CRGB fColor, CRGB bColor, int nLEDs, uint16_t speed )
+{
+	Sweeper  sweep( dLEDs );
+
+	dLEDs->setBackground( bColor );
+	dLEDs->setForeground( fColor );
 
 	sweep.setNumLEDs( nLEDs );
-	sweep.setCycles(0);
+	sweep.setCycles( 0 );
+	sweep.setSmooth( speed );
+
+	sweep.run();
+}
+
+void mode_program( LedDevice * dLEDs, CRGB fColor, CRGB bColor )
+{
+	ProgramShow  program( dLEDs );
+
+	dLEDs->setBackground( bColor );
+	dLEDs->setForeground( fColor );
+
+	// Register 1 of a program is the number of LED units it lights, @see
+	// extras/programs.
+	program.setRegister( 1, 10 );
 
 	for ( ; ; )
 	{
-		sweep.run();
+		program.run();
 		CHECK_MODE_CHANGE;
 	}
 }
 
+/**
+ * Blends a faint sparkle layer over a smooth sweep on the ring.  Each layer
+ * runs on its own BufferDevice at its own frame time.  @see Compositor
+ */
+void mode_ringLayers( CRGB fColor, int nLEDs, uint16_t speed )
+{
+	CRGB          sweepLEDs[LedRing_RING_SIZE];
+	CRGB          sparkleLEDs[LedRing_RING_SIZE];
+	CRGB          cache[LedRing_RING_SIZE];
+	BufferDevice  sweepLayer( LedRing_RING_SIZE, sweepLEDs );
+	BufferDevice  sparkleLayer( LedRing_RING_SIZE, sparkleLEDs );
+
+	sweepLayer.setBackground( CRGB::Black );
+	sweepLayer.setForeground( fColor );
+	sparkleLayer.setBackground( CRGB::Black );
+
+	Sweeper      sweep( &sweepLayer );
+	SparkleLEDs  sparkle( &sparkleLayer );
+	Compositor   layers( &ring, cache );
+
+	sweep.setNumLEDs( nLEDs );
+	sweep.setCycles(0);
+	sweep.setSmooth( speed );
+
+	layers.addLayer( &sweep );
+	layers.addLayer( &sparkle, BLEND_ALPHA, 64 );
+
+	layers.run();
+}
+
+/**
+ * Scrolls a palette along the device.  @see PaletteShow
+ *
+ * @param palette  A palette in flash, or NULL for the color wheel.
+ */
+void mode_palette( LedDevice * dLEDs, const uint8_t * palette )
+{
+	PaletteShow  show( dLEDs, palette );
+
+	show.run();
+}
 
 void mode_sparkle( LedDevice * dLEDs )
 {
@@ -170,6 +516,55 @@ void mode_sparkle( LedDevice * dLEDs )
 	lights.run();
 }
 
+/**
+ * Runs rainbow bands through the strip and the ring.  The spatial shows
+ * cover both devices, @see LedStrip::COORDINATES and LedRing::COORDINATES
+ * for where they are.
+ */
+void mode_planeWave()
+{
+	SpatialShow  wave( &strip, Colors::RAINBOW_PALETTE );
+
+	wave.addDevice( &ring );
+	wave.setPlaneWave( 0, 300, 200 );
+
+	wave.run();
+}
+
+/**
+ * Spreads rings out from the ring along the strip.
+ */
+void mode_radialPulse()
+{
+	SpatialShow  pulse( &strip, Colors::OCEAN_PALETTE );
+
+	pulse.addDevice( &ring );
+	pulse.setRadialPulse( 500, 100, 150, 150 );
+
+	pulse.run();
+}
+
+/**
+ * Flashes the strip and the ring on the beat from the audio pin.
+ */
+void mode_music()
+{
+	AudioShow  music( &strip, AUDIO_PIN, Colors::PARTY_PALETTE );
+
+	music.addDevice( &ring );
+
+	music.run();
+}
+
+void mode_particles( LedDevice * dLEDs )
+{
+	dLEDs->setBackground( CRGB::Black );
+
+	ParticleSparkle  lights( dLEDs );
+
+	lights.run();
+}
+
 
 void mode_default()
 {
@@ -182,20 +577,23 @@ void mode_default()
 		color = colorWheel.nextColor();
 
 		ring.setLEDs(color);
-		ring.show();
+		ring.commit();
 
 		strip.setLEDs(color);
-		strip.show();
+		strip.commit();
 
 		CHECK_MODE_CHANGE;
-		delay(1000);
+		Clock::delay(1000);
 		CHECK_MODE_CHANGE;
 	}
 }
 
 void setup()
 {
-	// Initialize Serial Communication, used for debugging
+	paint_memory();
+
+	// Initialize Serial Communication, used for the binary event log.
+	// @see EventLog.h
 	Serial.begin(9600);
 
 	// Initialize Pseudo Random Generator.
@@ -212,7 +610,20 @@ void setup()
 	pinMode( INTR_PIN, INPUT);
 	attachInterrupt(INTR, ModeInterrupt, RISING);
 
-	Serial.println("Initialization Done.\r");
+	// Double buffer the ring.  Most light shows change the previous frame,
+	// so the shown frame is copied back after each swap.
+	ring.setBackBuffer( ringBack, true );
+
+	// The strip is a generic 5050 strip, which is too blue without correction.
+	strip.setCorrection( TypicalLEDStrip );
+
+	// Fade light shows in and out on a mode change rather than cut.
+	strip.setFadeTime( FADE_MS );
+	ring.setFadeTime( FADE_MS );
+
+	configure_shows();
+
+	EventLog::log( LOG_BOOT );
 }
 
 void loop()
@@ -221,9 +632,8 @@ void loop()
 
 	if ( mode != last_mode )
 	{
-		Serial.print("New Mode: ");
-		Serial.print(mode);
-		Serial.print("\n\r");
+		EventLog::log( LOG_MODE_CHANGE, mode );
+		LightShow::markSwitch();
 
 		last_mode = mode;
 	}
@@ -237,30 +647,30 @@ void loop()
 			break;
 
 		case 1:  // Fill Solid Strip
-			mode_solid( & strip );
+			mode_solid( stripSolid, stripSolidColors );
 			break;
 
 		case 2:  // Fill Solid Ring
-			mode_solid( &ring );
+			mode_solid( ringSolid, ringSolidColors );
 			break;
 
 		case 3:  // Sweeper Strip
-			mode_sweeper( &strip, 10, 4);
+			mode_sweeper( stripSweep, stripSweepColors );
 			// mode_sweepStrip(4);
 			break;
 
 		case 4:  // Sweeper Infinite Strip
-			mode_iSweep( &strip, CRGB::Red, CRGB::DarkBlue, 10 );
+			mode_iSweep( stripInfinite, CRGB::Red, CRGB::DarkBlue );
 			break;
 
 		case 5:  // Sweeper Ring
-			mode_sweeper( &ring, 3, 4);
+			mode_sweeper( ringSweep, ringSweepColors );
 			//mode_sweepRing(4);
 			break;
 
 		case 6:  // Sweeper Infinity Ring
-			//mode_iSweep( &ring, CRGB::Green, CRGB::Violet, 3 );
-			mode_iSweep( &ring, CRGB::Blue, CRGB::Yellow, 3 );
+			//mode_iSweep( ringInfinite, CRGB::Green, CRGB::Violet );
+			mode_iSweep( ringInfinite, CRGB::Blue, CRGB::Yellow );
 			break;
 
 		case 7:  // Sparkles Strip
@@ -271,6 +681,50 @@ void loop()
 			mode_sparkle( &ring );
 			break;
 
+		case 9:  // Smooth Sweeper Ring, 6 LEDs per second
+			mode_smoothSweep( &ring, CRGB::Blue, CRGB::Black, 3, 6 << 8 );
+			break;
+
+		case 10: // Sparkles over Smooth Sweeper Ring
+			mode_ringLayers( CRGB::White, 3, 6 << 8 );
+			break;
+
+		case 11: // Rainbow Strip
+			mode_palette( &strip, NULL );
+			break;
+
+		case 12: // Heat Palette Ring
+			mode_palette( &ring, Colors::HEAT_PALETTE );
+			break;
+
+		case 13: // Particle Sparkles Strip
+			mode_particles( &strip );
+			break;
+
+		case 14: // Plane Wave through the Strip and the Ring
+			mode_planeWave();
+			break;
+
+		case 15: // Radial Pulse from the Ring
+			mode_radialPulse();
+			break;
+
+		case 16: // Sweeper on the long strip
+			mode_longSweep();
+			break;
+
+		case 17: // Fill Solid on the long strip
+			mode_longFill( longFillColors );
+			break;
+
+		case 18: // Music on the Strip and the Ring
+			mode_music();
+			break;
+
+		case 19: // Program from EEPROM on the Strip
+			mode_program( &strip, CRGB::Green, CRGB::Black );
+			break;
+
 		default:
 			mode_default();
 			break;
@@ -5,15 +5,18 @@
  *  @author Steven F. Lebrun
  */
 
+#include "Clock.h"
 #include "Interrupts.h"
 #include "Sweeper.h"
 
-const int Sweeper::SWEEP_DELAY = 50;
+const int Sweeper::SWEEP_DELAY  = 50;
+const int Sweeper::SMOOTH_DELAY = 10;
 
 Sweeper::Sweeper( LedDevice * dLEDs ) :
-	LightShow(dLEDs), fPixels( 2 ), nCycles(0)
+	LightShow(dLEDs, SWEEP_DELAY), fPixels( 2 ), nCycles(0), cycle(0), step(-1),
+	velocity(0), position(0), easing(EASE_LINEAR), lastTime(0)
 {
-
+	Animator::set( motion, 0, 0, 1 );
 }
 
 Sweeper::~Sweeper()
@@ -26,91 +29,214 @@ void Sweeper::setNumLEDs( int numLEDs )
 			numLEDs : (device->numberOfLEDs()/2);
 }
 
-void Sweeper::display( )
+void Sweeper::setSmooth( uint16_t speed )
 {
+	velocity   = speed;
+	frameDelay = ( velocity > 0 ) ? SMOOTH_DELAY : SWEEP_DELAY;
+}
+
+void Sweeper::start()
+{
+	cycle     = 0;
+	step      = -1;
+	position  = 0;
+}
+
+void Sweeper::resume()
+{
+	int   maxLEDs    = device->numberOfLEDs();
+	int   iterations = maxLEDs - fPixels;
+	int   offset;
 	int   i;
-	int   maxLEDs = device->numberOfLEDs();
 
-	// Initialize LEDs
-	for ( i = 0 ; i < fPixels ; ++i )
+	if ( step < 0 )
 	{
-		device->setLED(i, device->getForeground() );
+		// Not started yet; the first frame paints everything.
+		return;
 	}
 
-	for ( i = fPixels ; i < maxLEDs ; ++i )
+	if ( velocity > 0 )
 	{
-		device->setLED(i, device->getBackground() );
+		lastTime = Clock::millis();
+		paint( 0, maxLEDs - 1 );
+		return;
+	}
+
+	// Each step moves the foreground one LED Unit, forward for the first
+	// iterations steps and back for the rest.
+	offset = ( step <= iterations ) ? step : 2 * iterations - step;
+
+	if ( offset < 0 )
+	{
+		offset = 0;
 	}
 
-	device->show();
+	for ( i = 0 ; i < maxLEDs ; ++i )
+	{
+		bool  lit = ( i >= offset ) && ( i < offset + fPixels );
 
-	CHECK_INTR;
+		device->setLED( i, lit ? device->getForeground() : device->getBackground() );
+	}
+}
+
+bool Sweeper::nextFrame()
+{
+	if ( velocity > 0 )
+	{
+		return smoothFrame();
+	}
+
+	int iterations = device->numberOfLEDs() - fPixels;
+
+	if ( step < 0 )
+	{
+		initialize();
+		step = 0;
+		return true;
+	}
+
+	if ( iterations <= 0 )
+	{
+		// Nothing to sweep, keep showing the initial frame.
+		return ( nCycles <= 0 );
+	}
+
+	if ( step >= 2*iterations )
+	{
+		// End of a full cycle, both forward and backward.  Cycles are only
+		// counted when there is a limit so the count cannot overflow.
+		step = 0;
+
+		if ( ( nCycles > 0 ) && ( ++cycle >= nCycles ) )
+		{
+			return false;
+		}
+	}
 
-	if ( nCycles > 0 )
+	if ( step < iterations )
 	{
-		limitedCycles();
+		device->advanceLEDs();
 	}
 	else
 	{
-		infiniteCycles();
+		device->retreatLEDs();
 	}
 
-	return;
+	++step;
 
-}   // end of Sweeper::display()
+	return true;
 
-void Sweeper::forwardSweep()
+}   // end of Sweeper::nextFrame()
+
+void Sweeper::initialize()
 {
-	int i;
-	int iterations = device->numberOfLEDs() - fPixels;
+	int   i;
+	int   maxLEDs = device->numberOfLEDs();
 
-	for ( i = 0 ; i < iterations ; ++i )
+	for ( i = 0 ; i < fPixels ; ++i )
 	{
-		device->advanceLEDs();
-		device->show();
-		delay(SWEEP_DELAY);
+		device->setLED(i, device->getForeground() );
+	}
 
-		CHECK_INTR;
+	for ( i = fPixels ; i < maxLEDs ; ++i )
+	{
+		device->setLED(i, device->getBackground() );
 	}
 }
 
-void Sweeper::backwardSweep()
+bool Sweeper::smoothFrame()
 {
-	int i;
-	int iterations = device->numberOfLEDs() - fPixels;
+	if ( step < 0 )
+	{
+		// Position zero is the same as the start of a normal sweep.  A
+		// pass takes the distance in 1/256ths of an LED Unit divided by
+		// the velocity in 1/256ths of an LED Unit per second.
+		initialize();
+		Animator::set( motion, 0, 0, (unsigned long) travel() * 256000UL / velocity, easing, TWEEN_PING_PONG );
+		lastTime = Clock::millis();
+		step     = 0;
+		return true;
+	}
 
-	for ( i = 0 ; i < iterations ; ++i )
+	if ( device->numberOfLEDs() <= fPixels )
 	{
-		device->retreatLEDs();
-		device->show();
-		delay(50);
+		// Nothing to sweep, keep showing the initial frame.
+		return ( nCycles <= 0 );
+	}
 
-		CHECK_INTR;
+	int  oldLead = position >> 8;
+
+	if ( move() && ( nCycles > 0 ) && ( ++cycle >= nCycles ) )
+	{
+		return false;
 	}
+
+	int  newLead = position >> 8;
+
+	// Only the LED Units covered before or after the move can change, so
+	// there is no need to touch the rest of the LED Device.
+	paint( min( oldLead, newLead ), max( oldLead, newLead ) + fPixels );
+
+	return true;
 }
 
-void Sweeper::limitedCycles()
+bool Sweeper::move()
 {
-	int  i;
+	unsigned long  now     = Clock::millis();
+	unsigned long  elapsed = now - lastTime;
 
-	for ( i = 0 ; i < nCycles ; ++i )
-	{
-		forwardSweep();
-		CHECK_EXIT;
+	lastTime = now;
 
-		backwardSweep();
-		CHECK_EXIT;
-	}
+	// A long pause, such as a counter report, should not fling the
+	// foreground across the LED Device.
+	Animator::update( &motion, 1, ( elapsed > Animator_MAX_STEP_MS ) ? Animator_MAX_STEP_MS : (uint16_t) elapsed );
+
+	position = ( (unsigned long) travel() * Animator::progress( motion ) + 0x80 ) >> 8;
+
+	return Animator::cycled( motion );
 }
 
-void Sweeper::infiniteCycles()
+void Sweeper::paint( int first, int last )
 {
-	for ( ; ; )
+	int      maxLEDs = device->numberOfLEDs();
+	int      lead    = position >> 8;
+	uint8_t  frac    = position & 0xFF;
+	CRGB     fColor  = device->getForeground();
+	CRGB     bColor  = device->getBackground();
+	CRGB     color;
+	int      i;
+
+	if ( first < 0 )
+	{
+		first = 0;
+	}
+
+	if ( last >= maxLEDs )
 	{
-		forwardSweep();
-		CHECK_EXIT;
+		last = maxLEDs - 1;
+	}
 
-		backwardSweep();
-		CHECK_EXIT;
+	// The foreground covers [position, position + fPixels), so the leading
+	// LED Unit is covered by (256 - frac)/256 and the trailing one by frac/256.
+	for ( i = first ; i <= last ; ++i )
+	{
+		if ( ( i < lead ) || ( i > lead + fPixels ) )
+		{
+			color = bColor;
+		}
+		else if ( i == lead )
+		{
+			color = ( frac == 0 ) ? fColor : blend( bColor, fColor, 256 - frac );
+		}
+		else if ( i == lead + fPixels )
+		{
+			color = ( frac == 0 ) ? bColor : blend( bColor, fColor, frac );
+		}
+		else
+		{
+			color = fColor;
+		}
+
+		device->setLED( i, color );
 	}
 }
@@ -10,12 +10,23 @@
 #ifndef SWEEPER_H_
 #define SWEEPER_H_
 
+#include "Animator.h"
 #include "LightShow.h"
 
 /**
  * The Light Show derived class that sweeps a fixed number of LED Units back
  * and forth across the LED Device.  This simulates the eyes of the Cylons from
  * Battlestar Galactica and KITT on Knight Rider.
+ *
+ * By default the foreground LED Units move exactly one LED Unit per frame
+ * by shifting the colors of the LED Device.  In smooth mode, set with
+ * setSmooth(), the position of the foreground LED Units is tracked in
+ * fractions of an LED Unit and moves at a fixed speed regardless of the
+ * frame rate.  The LED Units at either end of the foreground are blended
+ * with the background color in proportion to how much of them is covered,
+ * so the foreground glides between LED Units instead of stepping.  The
+ * motion is a ping pong Tween run by the Animator, so it can follow an
+ * easing curve, @see setEasing().
  */
 class Sweeper: public LightShow
 {
@@ -27,6 +38,13 @@ class Sweeper: public LightShow
 		 */
 		static  const int SWEEP_DELAY;
 
+		/**
+		 * The amount of time, in milliseconds, between frames in smooth mode.
+		 * Smooth mode does not depend on the frame rate for its speed, so a
+		 * short delay only makes the motion finer.
+		 */
+		static  const int SMOOTH_DELAY;
+
 	protected:
 		/**
 		 * The number of Foreground Pixels [LEDs] that sweep back and forth.
@@ -41,6 +59,48 @@ class Sweeper: public LightShow
 		 */
 		int nCycles;
 
+		/**
+		 * The number of full cycles completed since the light show started.
+		 */
+		int cycle;
+
+		/**
+		 * The frame within the current cycle.  Frames [0 .. iterations) move
+		 * the foreground LED Units forward, frames [iterations .. 2*iterations)
+		 * move them back, where iterations is the number of LED Units minus
+		 * fPixels.  A value of -1 means the LED Units still need to be
+		 * initialized.
+		 */
+		int step;
+
+		/**
+		 * The speed of the foreground LED Units in smooth mode, in LED Units
+		 * per second as an 8.8 fixed point number.  Zero turns smooth mode off.
+		 */
+		uint16_t velocity;
+
+		/**
+		 * The position of the first foreground LED Unit in smooth mode, in
+		 * 1/256ths of an LED Unit.  The low 8 bits are the fraction.
+		 */
+		long     position;
+
+		/**
+		 * The motion in smooth mode: a ping pong tween from one end of the
+		 * LED Device to the other, timed from the velocity.
+		 */
+		Tween    motion;
+
+		/**
+		 * The EasingCurve of the motion in smooth mode.
+		 */
+		uint8_t  easing;
+
+		/**
+		 * The millis() value when the position was last updated.
+		 */
+		unsigned long lastTime;
+
 	public:
 		/**
 		 * Constructor.
@@ -66,18 +126,39 @@ class Sweeper: public LightShow
 		virtual ~Sweeper();
 
 		/**
-		 * The method that controls the actual Light Show.
+		 * Restarts the light show from its first cycle.
+		 */
+		virtual void start();
+
+		/**
+		 * Repaints the foreground LED units where the sweep was suspended.
+		 * The position of a normal sweep follows from the step; a smooth
+		 * sweep keeps its position and restarts its clock so it does not
+		 * jump by the time spent suspended.
+		 */
+		virtual void resume();
+
+		/**
+		 * The method that controls the actual Light Show.  The first frame
+		 * sets the foreground LED Units at the start of the LED Device and
+		 * each frame after that moves them one LED Unit forward or backward.
 		 *
-		 * If the number of cycles is finite, this method will return after
+		 * If the number of cycles is finite, the light show finishes after
 		 * that many full cycles has occurred.  If the number of cycles is
-		 * set to infinite, this method will only return after a Mode Change
+		 * set to infinite, the light show only stops after a Mode Change
 		 * Interrupt has occurred.
 		 *
 		 * @pre A call to setNumLEDs() and to setCycles() must be made before
-		 *      this method can be invoked, implicitly though the run() in the
-		 *      parent class.
+		 *      the light show is started through the run() in the parent class.
+		 *
+		 * @return Returns @b false after the last cycle has been shown.
+		 */
+		virtual bool nextFrame();
+
+		/**
+		 * @return Returns SHOW_SWEEPER.
 		 */
-		virtual void display( );
+		virtual uint8_t getShowType() { return SHOW_SWEEPER; };
 
 		/**
 		 * An inline method to allow read-only access to the number of LED Units
@@ -110,30 +191,65 @@ class Sweeper: public LightShow
 		 */
 		void setCycles( int numberOfCycles ) { nCycles = numberOfCycles; };
 
+		/**
+		 * Turns smooth mode on or off.
+		 *
+		 * @param speed  The speed of the foreground LED Units in LED Units
+		 *               per second as an 8.8 fixed point number, for example
+		 *               20 << 8 for twenty LED Units per second.  Zero turns
+		 *               smooth mode off and returns to one LED Unit per frame.
+		 *               A new speed takes effect when the light show starts.
+		 */
+		void setSmooth( uint16_t speed );
+
+		/**
+		 * Sets the easing curve of each pass in smooth mode.  The speed set
+		 * with setSmooth() is then the average speed of a pass.
+		 *
+		 * @param curve  One of the EasingCurve values, for example
+		 *               EASE_IN_OUT to slow down at either end like the
+		 *               scanner of KITT.  EASE_LINEAR by default.
+		 */
+		void setEasing( uint8_t curve ) { easing = curve; };
+
 	protected:
 
 		/**
-		 * Moves the foreground LED Units from the beginning of the
-		 * LED Device to the end.  This is the first half of a full cycle.
+		 * Sets the first fPixels LED Units to the foreground color and the
+		 * rest to the background color.
 		 */
-		void forwardSweep();
+		void initialize();
 
 		/**
-		 * Moves the foreground LED Units from the end of the LED Device to
-		 * the beginning.  This is the second half of a full cycle.
+		 * Renders one frame in smooth mode.
+		 *
+		 * @return Returns @b false after the last cycle has been shown.
+		 */
+		bool smoothFrame();
+
+		/**
+		 * Moves the foreground LED Units by the time since the last frame,
+		 * bouncing off either end of the LED Device.
+		 *
+		 * @return Returns @b true if a full cycle was completed.
 		 */
-		void backwardSweep();
+		bool move();
 
 		/**
-		 * Runs a finite number of full cycles for the display() method.
+		 * @return Returns the distance the first foreground LED Unit
+		 *         travels in each pass, in LED Units.
 		 */
-		void limitedCycles();
+		int travel() { return device->numberOfLEDs() - fPixels; };
 
 		/**
-		 * Runs an infinite number of cycles for the display() method.  This
-		 * method will exit when a Mode Change Interrupt has been detected.
+		 * Sets the LED Units between first and last, inclusive, to the colors
+		 * for the current position.  LED Units outside the LED Device are
+		 * ignored.
+		 *
+		 * @param first  The offset of the first LED Unit to set.
+		 * @param last   The offset of the last LED Unit to set.
 		 */
-		void infiniteCycles();
+		void paint( int first, int last );
 };
 
 #endif /* SWEEPER_H_ */
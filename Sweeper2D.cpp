@@ -0,0 +1,107 @@
+/*
+ * Sweeper2D.cpp
+ *
+ *  Created on: Oct 18, 2026
+ *      Author: Steven F. LeBrun
+ */
+
+#include "Sweeper2D.h"
+
+Sweeper2D::Sweeper2D( LedDevice * dLEDs ) :
+	LightShow(dLEDs, Sweeper2D_DELAY), fLines(2), vertical(false), nCycles(0), cycle(0), step(-1)
+{
+}
+
+Sweeper2D::~Sweeper2D()
+{
+}
+
+int Sweeper2D::lines()
+{
+	XYMap *  map = device->getMap();
+
+	return vertical ? map->getHeight() : map->getWidth();
+}
+
+void Sweeper2D::start()
+{
+	cycle = 0;
+	step  = -1;
+}
+
+void Sweeper2D::resume()
+{
+	int  iterations = lines() - fLines;
+
+	if ( step < 0 )
+	{
+		// Not started yet; the first frame paints everything.
+		return;
+	}
+
+	paint( ( step <= iterations ) ? step : 2 * iterations - step );
+}
+
+bool Sweeper2D::nextFrame()
+{
+	int  iterations = lines() - fLines;
+
+	if ( step < 0 )
+	{
+		paint( 0 );
+		step = 0;
+		return true;
+	}
+
+	if ( iterations <= 0 )
+	{
+		// Nothing to sweep, keep showing the initial frame.
+		return ( nCycles <= 0 );
+	}
+
+	if ( step >= 2 * iterations )
+	{
+		step = 0;
+
+		if ( ( nCycles > 0 ) && ( ++cycle >= nCycles ) )
+		{
+			return false;
+		}
+	}
+
+	int8_t  delta = ( step < iterations ) ? 1 : -1;
+
+	if ( vertical )
+	{
+		device->shiftLEDs( 0, delta );
+	}
+	else
+	{
+		device->shiftLEDs( delta, 0 );
+	}
+
+	++step;
+
+	return true;
+}
+
+void Sweeper2D::paint( int offset )
+{
+	XYMap *  map = device->getMap();
+
+	if ( offset < 0 )
+	{
+		offset = 0;
+	}
+
+	device->fillRect( 0, 0, map->getWidth(), map->getHeight(), device->getBackground() );
+
+	if ( vertical )
+	{
+		device->fillRect( 0, offset, map->getWidth(), fLines, device->getForeground() );
+	}
+	else
+	{
+		device->fillRect( offset, 0, fLines, map->getHeight(), device->getForeground() );
+	}
+}
@@ -0,0 +1,131 @@
+/**
+ * Light Show derived class that sweeps a bar of columns or rows back and
+ * forth across an LED matrix.
+ *
+ *  @date   Created on October 18, 2026
+ *  @author Steven F. LeBrun
+ *  <br/><br/>
+ */
+
+#ifndef SWEEPER2D_H_
+#define SWEEPER2D_H_
+
+#include "LightShow.h"
+
+/**
+ * The time, in milliseconds, each position of the bar is shown.
+ */
+#define  Sweeper2D_DELAY   50
+
+/**
+ * The matrix version of Sweeper.  A bar of foreground columns, or rows,
+ * moves one column per frame across the matrix and back by shifting the
+ * colors of the matrix with LedDevice::shiftLEDs(), the way Sweeper moves
+ * its LED units with advanceLEDs() and retreatLEDs().
+ *
+ * The LED Device must have a map, @see LedDevice::setMap().
+ */
+class Sweeper2D: public LightShow
+{
+	protected:
+		/**
+		 * The thickness of the bar in columns or rows.
+		 */
+		uint8_t  fLines;
+
+		/**
+		 * Set to @b true to sweep a bar of rows up and down instead of a
+		 * bar of columns left and right.
+		 */
+		bool     vertical;
+
+		/**
+		 * Number of times to perform a sweep, both forward and backward.
+		 * Zero performs an infinite number of sweeps.
+		 */
+		int      nCycles;
+
+		/**
+		 * The number of full cycles completed since the light show started.
+		 */
+		int      cycle;
+
+		/**
+		 * The frame within the current cycle, as in Sweeper.  A value of -1
+		 * means the matrix still needs to be initialized.
+		 */
+		int      step;
+
+	public:
+		/**
+		 * Constructor.
+		 *
+		 * @param dLEDs  Pointer to the LED Device to be used.  It must have a map.
+		 */
+		Sweeper2D( LedDevice * dLEDs );
+
+		/**
+		 * Destructor.
+		 */
+		virtual ~Sweeper2D();
+
+		/**
+		 * Restarts the light show from its first cycle.
+		 */
+		virtual void start();
+
+		/**
+		 * Repaints the bar where the sweep was suspended.
+		 */
+		virtual void resume();
+
+		/**
+		 * Moves the bar one column or row.  The first frame paints the bar
+		 * along the first edge of the matrix.
+		 *
+		 * @return Returns @b false after the last cycle has been shown.
+		 */
+		virtual bool nextFrame();
+
+		/**
+		 * @return Returns SHOW_SWEEPER_2D.
+		 */
+		virtual uint8_t getShowType() { return SHOW_SWEEPER_2D; };
+
+		/**
+		 * Sets the thickness of the bar.
+		 *
+		 * @param lines  The number of columns, or rows, in the bar.
+		 */
+		void setNumLines( uint8_t lines ) { fLines = lines; };
+
+		/**
+		 * Chooses between a bar of columns and a bar of rows.
+		 *
+		 * @param rows  @b true to sweep a bar of rows up and down.
+		 */
+		void setVertical( bool rows ) { vertical = rows; };
+
+		/**
+		 * Sets the number of full cycles the display method will run before
+		 * returning.
+		 *
+		 * @param numberOfCycles  The number of cycles, zero for infinite.
+		 */
+		void setCycles( int numberOfCycles ) { nCycles = numberOfCycles; };
+
+	protected:
+		/**
+		 * @return Returns the number of columns, or rows, the bar moves across.
+		 */
+		int lines();
+
+		/**
+		 * Sets the matrix to the background color with the bar at an offset.
+		 *
+		 * @param offset  The first column, or row, of the bar.
+		 */
+		void paint( int offset );
+};
+
+#endif /* SWEEPER2D_H_ */
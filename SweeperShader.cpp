@@ -0,0 +1,67 @@
+/*
+ * SweeperShader.cpp
+ *
+ *  Created on: Oct 18, 2026
+ *      Author: Steven F. LeBrun
+ */
+
+#include "SweeperShader.h"
+
+SweeperShader::SweeperShader( LedDevice * dLEDs ) :
+	PixelShader(dLEDs, SweeperShader_DELAY), fPixels(2), nCycles(0), cycle(0), step(-1), offset(0)
+{
+}
+
+SweeperShader::~SweeperShader()
+{
+}
+
+void SweeperShader::setNumLEDs( int numLEDs )
+{
+	fPixels = ( numLEDs < device->numberOfLEDs() ) ?
+			numLEDs : ( device->numberOfLEDs() / 2 );
+}
+
+void SweeperShader::start()
+{
+	cycle = 0;
+	step  = -1;
+}
+
+bool SweeperShader::prepare()
+{
+	int  iterations = device->numberOfLEDs() - fPixels;
+
+	foreground = device->getForeground();
+	background = device->getBackground();
+
+	if ( step < 0 )
+	{
+		step   = 0;
+		offset = 0;
+		return true;
+	}
+
+	if ( iterations <= 0 )
+	{
+		// Nothing to sweep, keep showing the first frame.
+		return ( nCycles <= 0 );
+	}
+
+	if ( step >= 2 * iterations )
+	{
+		step = 0;
+
+		if ( ( nCycles > 0 ) && ( ++cycle >= nCycles ) )
+		{
+			return false;
+		}
+	}
+
+	++step;
+
+	// Forward for the first iterations steps and back for the rest.
+	offset = ( step <= iterations ) ? step : 2 * iterations - step;
+
+	return true;
+}
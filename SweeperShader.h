@@ -0,0 +1,119 @@
+/**
+ * Pixel shader version of the Sweeper light show.
+ *
+ *  @date   Created on October 18, 2026
+ *  @author Steven F. LeBrun
+ *  <br/><br/>
+ */
+
+#ifndef SWEEPERSHADER_H_
+#define SWEEPERSHADER_H_
+
+#include "PixelShader.h"
+
+/**
+ * The time, in milliseconds, each position of the foreground LED units is
+ * shown, the same as Sweeper.
+ */
+#define  SweeperShader_DELAY   50
+
+/**
+ * Sweeps a fixed number of foreground LED units back and forth across the
+ * LED Device, one LED unit per frame, like Sweeper.  Sweeper moves the
+ * colors of the color array; this light show only keeps the position of
+ * the first foreground LED unit and works out the color of each LED unit
+ * from it, so it also runs on a ShaderDevice.
+ */
+class SweeperShader: public PixelShader
+{
+	protected:
+		/**
+		 * The number of foreground LED units.
+		 */
+		int   fPixels;
+
+		/**
+		 * Number of full cycles to perform, zero for an infinite number.
+		 */
+		int   nCycles;
+
+		/**
+		 * The number of full cycles completed since the light show started.
+		 */
+		int   cycle;
+
+		/**
+		 * The frame within the current cycle, as in Sweeper.  A value of -1
+		 * means the first frame has not been shown.
+		 */
+		int   step;
+
+		/**
+		 * The offset of the first foreground LED unit for the current frame.
+		 */
+		int   offset;
+
+		/**
+		 * The foreground and background colors of the current frame, read
+		 * from the LED Device by prepare().
+		 */
+		CRGB  foreground;
+		CRGB  background;
+
+	public:
+		/**
+		 * Constructor.
+		 *
+		 * @param dLEDs  Pointer to the LED Device to be used.
+		 */
+		SweeperShader( LedDevice * dLEDs );
+
+		/**
+		 * Destructor.
+		 */
+		virtual ~SweeperShader();
+
+		/**
+		 * Restarts the light show from its first cycle.
+		 */
+		virtual void start();
+
+		/**
+		 * Moves the foreground LED units one LED unit.
+		 *
+		 * @return Returns @b false after the last cycle has been shown.
+		 */
+		virtual bool prepare();
+
+		/**
+		 * @param index  The offset of the LED unit.
+		 * @return Returns the foreground color for the foreground LED units
+		 *         and the background color for the rest.
+		 */
+		virtual CRGB shade( int index )
+		{
+			return ( index >= offset && index < offset + fPixels ) ? foreground : background;
+		}
+
+		/**
+		 * @return Returns SHOW_SWEEPER_SHADER.
+		 */
+		virtual uint8_t getShowType() { return SHOW_SWEEPER_SHADER; };
+
+		/**
+		 * Sets the number of foreground LED units.
+		 *
+		 * @param numLEDs  The number of LED units, less than the number of
+		 *                 LED units of the LED Device.
+		 */
+		void setNumLEDs( int numLEDs );
+
+		/**
+		 * Sets the number of full cycles to perform.
+		 *
+		 * @param numberOfCycles  The number of cycles, zero for infinite.
+		 */
+		void setCycles( int numberOfCycles ) { nCycles = numberOfCycles; };
+};
+
+#endif /* SWEEPERSHADER_H_ */
@@ -0,0 +1,24 @@
+/*
+ * TimingStats.cpp
+ *
+ *  Created on: Oct 18, 2026
+ *      Author: Steven F. LeBrun
+ */
+
+#include "EventLog.h"
+#include "TimingStats.h"
+
+/**
+ * Limits a value to the range of a log argument.
+ */
+static uint16_t clamp16( unsigned long value )
+{
+	return ( value > 0xFFFFUL ) ? 0xFFFF : (uint16_t) value;
+}
+
+void TimingStats::log( uint8_t event, uint16_t id )
+{
+	uint16_t  args[] = { id, clamp16(getMin()), clamp16(getAverage()), clamp16(getMax()) };
+
+	EventLog::write( event, 4, args );
+}
@@ -0,0 +1,109 @@
+/**
+ * Accumulates the minimum, average and maximum of a series of time
+ * measurements.
+ *
+ *  @date   Created on October 18, 2026
+ *  @author Steven F. LeBrun
+ *  <br/><br/>
+ */
+
+#ifndef TIMINGSTATS_H_
+#define TIMINGSTATS_H_
+
+#include <Arduino.h>
+
+/**
+ * The TimingStats class collects measurements, normally in microseconds,
+ * without storing them.  Recording a measurement is a handful of additions
+ * and comparisons so that it can be used on every frame of a light show.
+ *
+ * The running total is 32 bits, so the average becomes meaningless after
+ * about 71 minutes worth of accumulated microseconds.  The counters are
+ * expected to be reset long before then.
+ */
+class TimingStats
+{
+	private:
+		/**
+		 * The number of measurements recorded.
+		 */
+		unsigned long  count;
+
+		/**
+		 * The sum of the measurements recorded.
+		 */
+		unsigned long  total;
+
+		/**
+		 * The smallest measurement recorded.
+		 */
+		unsigned long  minimum;
+
+		/**
+		 * The largest measurement recorded.
+		 */
+		unsigned long  maximum;
+
+	public:
+		/**
+		 * Constructor.  Starts with no measurements.
+		 */
+		TimingStats() { reset(); };
+
+		/**
+		 * Discards all the measurements recorded so far.
+		 */
+		void reset()
+		{
+			count   = 0;
+			total   = 0;
+			minimum = 0xFFFFFFFFUL;
+			maximum = 0;
+		}
+
+		/**
+		 * Adds a measurement.
+		 *
+		 * @param value  The measurement, normally in microseconds.
+		 */
+		void record( unsigned long value )
+		{
+			++count;
+			total += value;
+
+			if ( value < minimum ) { minimum = value; }
+			if ( value > maximum ) { maximum = value; }
+		}
+
+		/**
+		 * @return Returns the number of measurements recorded.
+		 */
+		unsigned long getCount()   { return count; };
+
+		/**
+		 * @return Returns the smallest measurement, or zero if there are none.
+		 */
+		unsigned long getMin()     { return ( count > 0 ) ? minimum : 0; };
+
+		/**
+		 * @return Returns the average of the measurements, or zero if there are none.
+		 */
+		unsigned long getAverage() { return ( count > 0 ) ? ( total / count ) : 0; };
+
+		/**
+		 * @return Returns the largest measurement, or zero if there are none.
+		 */
+		unsigned long getMax()     { return maximum; };
+
+		/**
+		 * Writes the minimum, average and maximum to the EventLog.  Values
+		 * that do not fit in a log argument are written as 0xFFFF.
+		 *
+		 * @param event  The id of the record to write.
+		 * @param id     The first argument of the record, identifies what
+		 *               was measured.
+		 */
+		void log( uint8_t event, uint16_t id );
+};
+
+#endif /* TIMINGSTATS_H_ */
@@ -0,0 +1,46 @@
+/*
+ * VirtualClock.cpp
+ *
+ *  Created on: Oct 18, 2026
+ *      Author: Steven F. LeBrun
+ */
+
+#include "VirtualClock.h"
+
+VirtualClock::VirtualClock( uint64_t start ) :
+	now(start)
+{
+}
+
+VirtualClock::~VirtualClock()
+{
+}
+
+void VirtualClock::advance( uint64_t end )
+{
+	if ( end > now )
+	{
+		now = end;
+	}
+}
+
+unsigned long VirtualClock::readMillis()
+{
+	return (unsigned long) ( now / 1000 );
+}
+
+unsigned long VirtualClock::readMicros()
+{
+	return (unsigned long) now;
+}
+
+void VirtualClock::wait( unsigned long ms )
+{
+	advance( now + (uint64_t) ms * 1000 );
+	yield();
+}
+
+void VirtualClock::waitMicros( unsigned int us )
+{
+	advance( now + us );
+}
@@ -0,0 +1,87 @@
+/**
+ * Class derived from Clock that keeps time in a counter.
+ *
+ *  @date   Created on October 18, 2026
+ *  @author Steven F. LeBrun
+ *  <br/><br/>
+ */
+
+#ifndef VIRTUALCLOCK_H_
+#define VIRTUALCLOCK_H_
+
+#include "Clock.h"
+
+/**
+ * Class derived from Clock whose time only moves when it is waited on.
+ * Waiting moves the time forward at once, so a light show that waits 50
+ * milliseconds between frames runs as fast as it can render instead.  The
+ * time spent rendering does not count.
+ *
+ * Used to run the sketch on a host, @see extras/TraceReplay.cpp.  A derived
+ * class can override advance() to do something at given times, such as
+ * raising an interrupt.
+ */
+class VirtualClock: public Clock
+{
+	protected:
+		/**
+		 * The number of microseconds since the clock started.
+		 */
+		uint64_t  now;
+
+		/**
+		 * Moves the time forward.
+		 *
+		 * @param end  The new time in microseconds.  The time never moves
+		 *             backwards.
+		 */
+		virtual void advance( uint64_t end );
+
+	public:
+		/**
+		 * Constructor.
+		 *
+		 * @param start  The time to start at, in microseconds.
+		 */
+		VirtualClock( uint64_t start = 0 );
+
+		/**
+		 * Destructor.
+		 */
+		virtual ~VirtualClock();
+
+		/**
+		 * @return Returns the time in microseconds, without wrapping.
+		 */
+		uint64_t read() { return now; };
+
+		/**
+		 * Sets the time, for example to start a replay at a recorded time.
+		 *
+		 * @param us  The new time in microseconds.
+		 */
+		void set( uint64_t us ) { now = us; };
+
+		/**
+		 * @return Returns the time in milliseconds.
+		 */
+		virtual unsigned long readMillis();
+
+		/**
+		 * @return Returns the time in microseconds.
+		 */
+		virtual unsigned long readMicros();
+
+		/**
+		 * Moves the time forward and then calls yield(), as the Arduino
+		 * delay() does while it waits.
+		 */
+		virtual void wait( unsigned long ms );
+
+		/**
+		 * Moves the time forward.
+		 */
+		virtual void waitMicros( unsigned int us );
+};
+
+#endif /* VIRTUALCLOCK_H_ */
@@ -0,0 +1,103 @@
+/*
+ * XYMap.cpp
+ *
+ *  Created on: Oct 18, 2026
+ *      Author: Steven F. LeBrun
+ */
+
+#include "XYMap.h"
+
+// The tables below are generated by extras/XYTableGen.cpp.
+
+const uint16_t XYMap::SERPENTINE_16x16[] PROGMEM =
+{
+	   0,    1,    2,    3,    4,    5,    6,    7,    8,    9,   10,   11,   12,   13,   14,   15,
+	  31,   30,   29,   28,   27,   26,   25,   24,   23,   22,   21,   20,   19,   18,   17,   16,
+	  32,   33,   34,   35,   36,   37,   38,   39,   40,   41,   42,   43,   44,   45,   46,   47,
+	  63,   62,   61,   60,   59,   58,   57,   56,   55,   54,   53,   52,   51,   50,   49,   48,
+	  64,   65,   66,   67,   68,   69,   70,   71,   72,   73,   74,   75,   76,   77,   78,   79,
+	  95,   94,   93,   92,   91,   90,   89,   88,   87,   86,   85,   84,   83,   82,   81,   80,
+	  96,   97,   98,   99,  100,  101,  102,  103,  104,  105,  106,  107,  108,  109,  110,  111,
+	 127,  126,  125,  124,  123,  122,  121,  120,  119,  118,  117,  116,  115,  114,  113,  112,
+	 128,  129,  130,  131,  132,  133,  134,  135,  136,  137,  138,  139,  140,  141,  142,  143,
+	 159,  158,  157,  156,  155,  154,  153,  152,  151,  150,  149,  148,  147,  146,  145,  144,
+	 160,  161,  162,  163,  164,  165,  166,  167,  168,  169,  170,  171,  172,  173,  174,  175,
+	 191,  190,  189,  188,  187,  186,  185,  184,  183,  182,  181,  180,  179,  178,  177,  176,
+	 192,  193,  194,  195,  196,  197,  198,  199,  200,  201,  202,  203,  204,  205,  206,  207,
+	 223,  222,  221,  220,  219,  218,  217,  216,  215,  214,  213,  212,  211,  210,  209,  208,
+	 224,  225,  226,  227,  228,  229,  230,  231,  232,  233,  234,  235,  236,  237,  238,  239,
+	 255,  254,  253,  252,  251,  250,  249,  248,  247,  246,  245,  244,  243,  242,  241,  240
+};
+
+const uint16_t XYMap::SERPENTINE_32x32[] PROGMEM =
+{
+	   0,    1,    2,    3,    4,    5,    6,    7,    8,    9,   10,   11,   12,   13,   14,   15,
+	  16,   17,   18,   19,   20,   21,   22,   23,   24,   25,   26,   27,   28,   29,   30,   31,
+	  63,   62,   61,   60,   59,   58,   57,   56,   55,   54,   53,   52,   51,   50,   49,   48,
+	  47,   46,   45,   44,   43,   42,   41,   40,   39,   38,   37,   36,   35,   34,   33,   32,
+	  64,   65,   66,   67,   68,   69,   70,   71,   72,   73,   74,   75,   76,   77,   78,   79,
+	  80,   81,   82,   83,   84,   85,   86,   87,   88,   89,   90,   91,   92,   93,   94,   95,
+	 127,  126,  125,  124,  123,  122,  121,  120,  119,  118,  117,  116,  115,  114,  113,  112,
+	 111,  110,  109,  108,  107,  106,  105,  104,  103,  102,  101,  100,   99,   98,   97,   96,
+	 128,  129,  130,  131,  132,  133,  134,  135,  136,  137,  138,  139,  140,  141,  142,  143,
+	 144,  145,  146,  147,  148,  149,  150,  151,  152,  153,  154,  155,  156,  157,  158,  159,
+	 191,  190,  189,  188,  187,  186,  185,  184,  183,  182,  181,  180,  179,  178,  177,  176,
+	 175,  174,  173,  172,  171,  170,  169,  168,  167,  166,  165,  164,  163,  162,  161,  160,
+	 192,  193,  194,  195,  196,  197,  198,  199,  200,  201,  202,  203,  204,  205,  206,  207,
+	 208,  209,  210,  211,  212,  213,  214,  215,  216,  217,  218,  219,  220,  221,  222,  223,
+	 255,  254,  253,  252,  251,  250,  249,  248,  247,  246,  245,  244,  243,  242,  241,  240,
+	 239,  238,  237,  236,  235,  234,  233,  232,  231,  230,  229,  228,  227,  226,  225,  224,
+	 256,  257,  258,  259,  260,  261,  262,  263,  264,  265,  266,  267,  268,  269,  270,  271,
+	 272,  273,  274,  275,  276,  277,  278,  279,  280,  281,  282,  283,  284,  285,  286,  287,
+	 319,  318,  317,  316,  315,  314,  313,  312,  311,  310,  309,  308,  307,  306,  305,  304,
+	 303,  302,  301,  300,  299,  298,  297,  296,  295,  294,  293,  292,  291,  290,  289,  288,
+	 320,  321,  322,  323,  324,  325,  326,  327,  328,  329,  330,  331,  332,  333,  334,  335,
+	 336,  337,  338,  339,  340,  341,  342,  343,  344,  345,  346,  347,  348,  349,  350,  351,
+	 383,  382,  381,  380,  379,  378,  377,  376,  375,  374,  373,  372,  371,  370,  369,  368,
+	 367,  366,  365,  364,  363,  362,  361,  360,  359,  358,  357,  356,  355,  354,  353,  352,
+	 384,  385,  386,  387,  388,  389,  390,  391,  392,  393,  394,  395,  396,  397,  398,  399,
+	 400,  401,  402,  403,  404,  405,  406,  407,  408,  409,  410,  411,  412,  413,  414,  415,
+	 447,  446,  445,  444,  443,  442,  441,  440,  439,  438,  437,  436,  435,  434,  433,  432,
+	 431,  430,  429,  428,  427,  426,  425,  424,  423,  422,  421,  420,  419,  418,  417,  416,
+	 448,  449,  450,  451,  452,  453,  454,  455,  456,  457,  458,  459,  460,  461,  462,  463,
+	 464,  465,  466,  467,  468,  469,  470,  471,  472,  473,  474,  475,  476,  477,  478,  479,
+	 511,  510,  509,  508,  507,  506,  505,  504,  503,  502,  501,  500,  499,  498,  497,  496,
+	 495,  494,  493,  492,  491,  490,  489,  488,  487,  486,  485,  484,  483,  482,  481,  480,
+	 512,  513,  514,  515,  516,  517,  518,  519,  520,  521,  522,  523,  524,  525,  526,  527,
+	 528,  529,  530,  531,  532,  533,  534,  535,  536,  537,  538,  539,  540,  541,  542,  543,
+	 575,  574,  573,  572,  571,  570,  569,  568,  567,  566,  565,  564,  563,  562,  561,  560,
+	 559,  558,  557,  556,  555,  554,  553,  552,  551,  550,  549,  548,  547,  546,  545,  544,
+	 576,  577,  578,  579,  580,  581,  582,  583,  584,  585,  586,  587,  588,  589,  590,  591,
+	 592,  593,  594,  595,  596,  597,  598,  599,  600,  601,  602,  603,  604,  605,  606,  607,
+	 639,  638,  637,  636,  635,  634,  633,  632,  631,  630,  629,  628,  627,  626,  625,  624,
+	 623,  622,  621,  620,  619,  618,  617,  616,  615,  614,  613,  612,  611,  610,  609,  608,
+	 640,  641,  642,  643,  644,  645,  646,  647,  648,  649,  650,  651,  652,  653,  654,  655,
+	 656,  657,  658,  659,  660,  661,  662,  663,  664,  665,  666,  667,  668,  669,  670,  671,
+	 703,  702,  701,  700,  699,  698,  697,  696,  695,  694,  693,  692,  691,  690,  689,  688,
+	 687,  686,  685,  684,  683,  682,  681,  680,  679,  678,  677,  676,  675,  674,  673,  672,
+	 704,  705,  706,  707,  708,  709,  710,  711,  712,  713,  714,  715,  716,  717,  718,  719,
+	 720,  721,  722,  723,  724,  725,  726,  727,  728,  729,  730,  731,  732,  733,  734,  735,
+	 767,  766,  765,  764,  763,  762,  761,  760,  759,  758,  757,  756,  755,  754,  753,  752,
+	 751,  750,  749,  748,  747,  746,  745,  744,  743,  742,  741,  740,  739,  738,  737,  736,
+	 768,  769,  770,  771,  772,  773,  774,  775,  776,  777,  778,  779,  780,  781,  782,  783,
+	 784,  785,  786,  787,  788,  789,  790,  791,  792,  793,  794,  795,  796,  797,  798,  799,
+	 831,  830,  829,  828,  827,  826,  825,  824,  823,  822,  821,  820,  819,  818,  817,  816,
+	 815,  814,  813,  812,  811,  810,  809,  808,  807,  806,  805,  804,  803,  802,  801,  800,
+	 832,  833,  834,  835,  836,  837,  838,  839,  840,  841,  842,  843,  844,  845,  846,  847,
+	 848,  849,  850,  851,  852,  853,  854,  855,  856,  857,  858,  859,  860,  861,  862,  863,
+	 895,  894,  893,  892,  891,  890,  889,  888,  887,  886,  885,  884,  883,  882,  881,  880,
+	 879,  878,  877,  876,  875,  874,  873,  872,  871,  870,  869,  868,  867,  866,  865,  864,
+	 896,  897,  898,  899,  900,  901,  902,  903,  904,  905,  906,  907,  908,  909,  910,  911,
+	 912,  913,  914,  915,  916,  917,  918,  919,  920,  921,  922,  923,  924,  925,  926,  927,
+	 959,  958,  957,  956,  955,  954,  953,  952,  951,  950,  949,  948,  947,  946,  945,  944,
+	 943,  942,  941,  940,  939,  938,  937,  936,  935,  934,  933,  932,  931,  930,  929,  928,
+	 960,  961,  962,  963,  964,  965,  966,  967,  968,  969,  970,  971,  972,  973,  974,  975,
+	 976,  977,  978,  979,  980,  981,  982,  983,  984,  985,  986,  987,  988,  989,  990,  991,
+	1023, 1022, 1021, 1020, 1019, 1018, 1017, 1016, 1015, 1014, 1013, 1012, 1011, 1010, 1009, 1008,
+	1007, 1006, 1005, 1004, 1003, 1002, 1001, 1000,  999,  998,  997,  996,  995,  994,  993,  992
+};
+
+XYMap::XYMap( uint8_t width, uint8_t height, uint8_t layout, uint8_t rotation, const uint16_t * table ) :
+	width(width), height(height), layout(layout), rotation(rotation & 3), table(table)
+{
+}
@@ -0,0 +1,209 @@
+/**
+ * Maps the column and row of a cell of an LED matrix to the offset of its
+ * LED unit along the data line.
+ *
+ *  @date   Created on October 18, 2026
+ *  @author Steven F. LeBrun
+ *  <br/><br/>
+ */
+
+#ifndef XYMAP_H_
+#define XYMAP_H_
+
+#include <Arduino.h>
+
+/**
+ * How the LED units of a matrix are wired, as seen from the first LED unit
+ * on the data line in the top left corner.
+ */
+enum XYLayout
+{
+	XY_PROGRESSIVE = 0,   ///< Every row runs left to right.
+	XY_SERPENTINE  = 1    ///< Even rows run left to right, odd rows right to left.
+};
+
+/**
+ * How the picture is turned relative to the wiring, clockwise.
+ */
+enum XYRotation
+{
+	XY_ROTATE_0    = 0,
+	XY_ROTATE_90   = 1,
+	XY_ROTATE_180  = 2,
+	XY_ROTATE_270  = 3
+};
+
+/**
+ * Maps the column and row of a cell to the offset of its LED unit.
+ *
+ * The offset is either calculated from the layout or read from an index
+ * table in flash.  A table costs two bytes of flash per LED unit but no
+ * RAM, replaces the arithmetic with a single read, and can describe a
+ * matrix wired in any order.  Tables are made by extras/XYTableGen.cpp.
+ *
+ * Columns and rows are given in the rotated picture, so a matrix turned
+ * by 90 or 270 degrees swaps its width and height.  Column 0, row 0 is the
+ * top left corner of the picture.
+ */
+class XYMap
+{
+	private:
+		/**
+		 * The number of columns as wired.
+		 */
+		uint8_t           width;
+
+		/**
+		 * The number of rows as wired.
+		 */
+		uint8_t           height;
+
+		/**
+		 * One of the XYLayout values.
+		 */
+		uint8_t           layout;
+
+		/**
+		 * One of the XYRotation values.
+		 */
+		uint8_t           rotation;
+
+		/**
+		 * The offset of each cell as wired, row by row, in flash, or NULL
+		 * to calculate the offsets from the layout.
+		 */
+		const uint16_t *  table;
+
+	public:
+		/**
+		 * Index table for a 16 x 16 serpentine matrix.
+		 */
+		static const uint16_t  SERPENTINE_16x16[];
+
+		/**
+		 * Index table for a 32 x 32 serpentine matrix.
+		 */
+		static const uint16_t  SERPENTINE_32x32[];
+
+		/**
+		 * Constructor.
+		 *
+		 * @param width     The number of columns as wired.
+		 * @param height    The number of rows as wired.
+		 * @param layout    One of the XYLayout values.  Ignored when a table
+		 *                  is given.
+		 * @param rotation  One of the XYRotation values.
+		 * @param table     An index table in flash with width * height
+		 *                  entries, or NULL to calculate the offsets.
+		 */
+		XYMap( uint8_t width, uint8_t height, uint8_t layout = XY_SERPENTINE,
+		       uint8_t rotation = XY_ROTATE_0, const uint16_t * table = NULL );
+
+		/**
+		 * @return Returns the number of columns of the picture.
+		 */
+		uint8_t getWidth() { return ( rotation & 1 ) ? height : width; };
+
+		/**
+		 * @return Returns the number of rows of the picture.
+		 */
+		uint8_t getHeight() { return ( rotation & 1 ) ? width : height; };
+
+		/**
+		 * @return Returns the number of cells.
+		 */
+		uint16_t size() { return (uint16_t) width * height; };
+
+		/**
+		 * Changes the index table.
+		 *
+		 * @param table  An index table in flash with one entry per cell, or
+		 *               NULL to calculate the offsets from the layout.
+		 */
+		void setTable( const uint16_t * table ) { this->table = table; };
+
+		/**
+		 * Changes the rotation of the picture.
+		 *
+		 * @param rotation  One of the XYRotation values.
+		 */
+		void setRotation( uint8_t rotation ) { this->rotation = rotation & 3; };
+
+		/**
+		 * Finds the LED unit of a cell, from the index table if there is one.
+		 *
+		 * @param x  The column, [0..getWidth()).
+		 * @param y  The row, [0..getHeight()).
+		 * @return Returns the offset of the LED unit.
+		 */
+		uint16_t index( uint8_t x, uint8_t y )
+		{
+			rotate( x, y );
+
+			if ( table != NULL )
+			{
+				return pgm_read_word( &table[ (uint16_t) y * width + x ] );
+			}
+
+			return wired( x, y );
+		}
+
+		/**
+		 * Finds the LED unit of a cell from the layout, ignoring the index
+		 * table.  Used to compare the two.
+		 *
+		 * @param x  The column, [0..getWidth()).
+		 * @param y  The row, [0..getHeight()).
+		 * @return Returns the offset of the LED unit.
+		 */
+		uint16_t compute( uint8_t x, uint8_t y )
+		{
+			rotate( x, y );
+
+			return wired( x, y );
+		}
+
+	private:
+		/**
+		 * Turns a column and row of the picture into a column and row as wired.
+		 */
+		void rotate( uint8_t & x, uint8_t & y )
+		{
+			uint8_t  t;
+
+			switch ( rotation )
+			{
+				case XY_ROTATE_90:
+					t = x;
+					x = y;
+					y = height - 1 - t;
+					break;
+
+				case XY_ROTATE_180:
+					x = width - 1 - x;
+					y = height - 1 - y;
+					break;
+
+				case XY_ROTATE_270:
+					t = x;
+					x = width - 1 - y;
+					y = t;
+					break;
+			}
+		}
+
+		/**
+		 * Calculates the offset of the LED unit at a column and row as wired.
+		 */
+		uint16_t wired( uint8_t x, uint8_t y )
+		{
+			if ( layout == XY_SERPENTINE && ( y & 1 ) )
+			{
+				x = width - 1 - x;
+			}
+
+			return (uint16_t) y * width + x;
+		}
+};
+
+#endif /* XYMAP_H_ */
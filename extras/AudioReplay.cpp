@@ -0,0 +1,451 @@
+/**
+ * Host side stand-in for the audio input of the AudioShow light show.
+ *
+ * Reads a WAV file, turns it into the 8 bit samples the ADC would give at
+ * AudioInput_SAMPLE_RATE and feeds them to AudioInput::addSample() in step
+ * with a VirtualClock, while an AudioShow runs on a strip and a ring made
+ * of BufferDevices.  It then reports:
+ *
+ *     the cost of the analysis on this host, per sample for the part done
+ *     by the interrupt and per frame for the rest of the light show;
+ *
+ *     the latency of each beat, from an onset found in the WAV file at
+ *     full rate to the frame that flashed for it.
+ *
+ * The onsets are found with a plain energy detector over 5 ms windows, so
+ * music with a clear kick drum gives the most useful numbers.
+ *
+ * Building, with FastLED built for its host (stub) platform:
+ *
+ *     g++ -O2 -Iextras/host -I$FASTLED/src -o AudioReplay \
+ *         extras/AudioReplay.cpp extras/host/Arduino.cpp \
+ *         $(ls *.cpp | grep -v StripTease.cpp) $FASTLED_OBJECTS
+ *     ./AudioReplay -v song.wav
+ *
+ * Options:
+ *
+ *     -g percent   Gain applied to the WAV file, default 100.
+ *     -v           Print every beat and onset.
+ *
+ *  @date   Created on October 18, 2026
+ *  @author Steven F. LeBrun
+ *  <br/><br/>
+ */
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include <Arduino.h>
+
+#include "../AudioInput.h"
+#include "../AudioShow.h"
+#include "../BufferDevice.h"
+#include "../Colors.h"
+#include "../VirtualClock.h"
+
+/**
+ * The length of the windows the onset detector works on, in milliseconds.
+ */
+#define  ONSET_WINDOW_MS   5
+
+/**
+ * The number of windows averaged as the background of the onset detector.
+ */
+#define  ONSET_HISTORY    40
+
+/**
+ * The shortest time between two onsets, in milliseconds.
+ */
+#define  ONSET_GAP_MS    100
+
+/**
+ * The longest latency counted as the beat of an onset, in milliseconds.
+ */
+#define  MAX_LATENCY_MS  250
+
+/**
+ * The largest number of onsets or beats recorded.
+ */
+#define  MAX_EVENTS     8192
+
+// Needed by the light shows, normally defined by the sketch.
+volatile bool           mode_change = false;
+volatile unsigned long  lastTime    = 0;
+
+void yield()
+{
+}
+
+/**
+ * The WAV file as mono samples of -32768 to 32767.
+ */
+static int16_t *       wav       = NULL;
+static long            wavLength = 0;
+static long            wavRate   = 0;
+
+/**
+ * The samples as the ADC would give them.
+ */
+static uint8_t *       adc       = NULL;
+static long            adcLength = 0;
+
+static unsigned long   onsets[MAX_EVENTS];
+static int             nOnsets   = 0;
+static unsigned long   beatTimes[MAX_EVENTS];
+static int             nBeats    = 0;
+
+/**
+ * The time spent in AudioInput::addSample() and the number of frames.
+ */
+static double          feedSeconds = 0;
+static long            frames      = 0;
+
+static double seconds()
+{
+	struct timespec  ts;
+
+	clock_gettime( CLOCK_MONOTONIC, &ts );
+
+	return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+static uint32_t readLE( const uint8_t * p, int n )
+{
+	uint32_t  v = 0;
+
+	for ( int i = n - 1 ; i >= 0 ; --i )
+	{
+		v = ( v << 8 ) | p[i];
+	}
+
+	return v;
+}
+
+/**
+ * Reads a PCM WAV file of 8 or 16 bits and any number of channels, and
+ * mixes it down to mono.
+ */
+static bool readWav( const char * path, int gain )
+{
+	FILE *     in = fopen( path, "rb" );
+	uint8_t    header[12];
+	uint8_t    chunk[8];
+	int        channels = 0;
+	int        bits     = 0;
+
+	if ( in == NULL )
+	{
+		perror( path );
+		return false;
+	}
+
+	if ( fread( header, 1, 12, in ) != 12 || memcmp( header, "RIFF", 4 ) != 0
+	     || memcmp( header + 8, "WAVE", 4 ) != 0 )
+	{
+		fprintf( stderr, "%s: not a WAV file\n", path );
+		fclose( in );
+		return false;
+	}
+
+	while ( fread( chunk, 1, 8, in ) == 8 )
+	{
+		uint32_t  size = readLE( chunk + 4, 4 );
+
+		if ( memcmp( chunk, "fmt ", 4 ) == 0 )
+		{
+			uint8_t  format[16];
+
+			if ( size < 16 || fread( format, 1, 16, in ) != 16 )
+			{
+				break;
+			}
+
+			if ( readLE( format, 2 ) != 1 )
+			{
+				fprintf( stderr, "%s: only PCM WAV files are supported\n", path );
+				fclose( in );
+				return false;
+			}
+
+			channels = readLE( format + 2, 2 );
+			wavRate  = readLE( format + 4, 4 );
+			bits     = readLE( format + 14, 2 );
+			fseek( in, size - 16 + ( size & 1 ), SEEK_CUR );
+		}
+		else if ( memcmp( chunk, "data", 4 ) == 0 && channels > 0 )
+		{
+			int        bytes = bits / 8;
+			uint8_t *  data  = (uint8_t *) malloc( size );
+
+			if ( ( bits != 8 && bits != 16 ) || data == NULL )
+			{
+				fprintf( stderr, "%s: only 8 and 16 bit samples are supported\n", path );
+				free( data );
+				fclose( in );
+				return false;
+			}
+
+			size      = fread( data, 1, size, in );
+			wavLength = size / ( bytes * channels );
+			wav       = (int16_t *) malloc( wavLength * sizeof(int16_t) );
+
+			for ( long n = 0 ; n < wavLength ; ++n )
+			{
+				long  sum = 0;
+
+				for ( int c = 0 ; c < channels ; ++c )
+				{
+					const uint8_t *  p = data + ( n * channels + c ) * bytes;
+
+					sum += ( bits == 8 ) ? ( (int) p[0] - 128 ) << 8 : (int16_t) readLE( p, 2 );
+				}
+
+				sum = sum / channels * gain / 100;
+				wav[n] = (int16_t) ( ( sum > 32767 ) ? 32767 : ( sum < -32768 ) ? -32768 : sum );
+			}
+
+			free( data );
+			fclose( in );
+			return true;
+		}
+		else
+		{
+			fseek( in, size + ( size & 1 ), SEEK_CUR );
+		}
+	}
+
+	fprintf( stderr, "%s: no audio found\n", path );
+	fclose( in );
+	return false;
+}
+
+/**
+ * Picks the WAV sample nearest each ADC sample time and keeps its top 8
+ * bits, with the bias of a microphone module at half the supply.
+ */
+static void resample()
+{
+	adcLength = (long) ( (double) wavLength * AudioInput_SAMPLE_RATE / wavRate );
+	adc       = (uint8_t *) malloc( adcLength );
+
+	for ( long n = 0 ; n < adcLength ; ++n )
+	{
+		long  source = (long) ( (double) n * wavRate / AudioInput_SAMPLE_RATE );
+
+		adc[n] = (uint8_t) ( ( wav[source] >> 8 ) + 128 );
+	}
+}
+
+/**
+ * Finds the onsets in the WAV file at its own rate: a window with more
+ * than twice the energy of the windows before it.
+ */
+static void findOnsets()
+{
+	long    window  = wavRate * ONSET_WINDOW_MS / 1000;
+	double  history[ONSET_HISTORY];
+	int     filled  = 0;
+	long    last    = -ONSET_GAP_MS;
+
+	for ( long start = 0 ; start + window <= wavLength ; start += window )
+	{
+		double  energy  = 0;
+		double  average = 0;
+		long    ms      = start * 1000 / wavRate;
+
+		for ( long n = start ; n < start + window ; ++n )
+		{
+			energy += (double) wav[n] * wav[n];
+		}
+
+		energy /= window;
+
+		for ( int h = 0 ; h < filled ; ++h )
+		{
+			average += history[h];
+		}
+
+		if ( filled == ONSET_HISTORY )
+		{
+			average /= filled;
+
+			if ( energy > 2 * average && energy > 1e5 && ms - last >= ONSET_GAP_MS && nOnsets < MAX_EVENTS )
+			{
+				onsets[nOnsets++] = ms;
+				last = ms;
+			}
+
+			memmove( history, history + 1, ( ONSET_HISTORY - 1 ) * sizeof(double) );
+			history[ONSET_HISTORY - 1] = energy;
+		}
+		else
+		{
+			history[filled++] = energy;
+		}
+	}
+}
+
+/**
+ * Thrown from inside the light show when the samples run out.
+ */
+struct ReplayEnd
+{
+};
+
+/**
+ * Feeds the samples that fall due while the light show waits, and notes
+ * the frames that found a beat.
+ */
+class AudioClock : public VirtualClock
+{
+	private:
+		AudioShow &  show;
+		long         next;
+		uint16_t     seen;
+
+	public:
+		AudioClock( AudioShow & show ) : show(show), next(0), seen(0) {};
+
+	protected:
+		virtual void advance( uint64_t end )
+		{
+			if ( show.getBeats() != seen && nBeats < MAX_EVENTS )
+			{
+				beatTimes[nBeats++] = (unsigned long) ( now / 1000 );
+			}
+
+			seen = show.getBeats();
+			++frames;
+
+			double  started = seconds();
+
+			while ( next < adcLength && (uint64_t) next * 1000000ULL / AudioInput_SAMPLE_RATE <= end )
+			{
+				AudioInput::addSample( adc[next++] );
+			}
+
+			feedSeconds += seconds() - started;
+
+			if ( next >= adcLength )
+			{
+				throw ReplayEnd();
+			}
+
+			VirtualClock::advance( end );
+		}
+};
+
+int main( int argc, char * argv[] )
+{
+	int   gain    = 100;
+	bool  verbose = false;
+	int   a;
+
+	for ( a = 1 ; a < argc && argv[a][0] == '-' ; ++a )
+	{
+		if ( strcmp( argv[a], "-g" ) == 0 && a + 1 < argc )
+		{
+			gain = atoi( argv[++a] );
+		}
+		else if ( strcmp( argv[a], "-v" ) == 0 )
+		{
+			verbose = true;
+		}
+		else
+		{
+			break;
+		}
+	}
+
+	if ( a + 1 != argc )
+	{
+		fprintf( stderr, "usage: %s [-g percent] [-v] file.wav\n", argv[0] );
+		return 1;
+	}
+
+	if ( ! readWav( argv[a], gain ) || wavRate <= 0 || wavLength == 0 )
+	{
+		return 1;
+	}
+
+	resample();
+	findOnsets();
+
+	CRGB          stripLEDs[60];
+	CRGB          ringLEDs[12];
+	BufferDevice  strip( 60, stripLEDs );
+	BufferDevice  ring( 12, ringLEDs );
+	AudioShow     show( &strip, A1, Colors::PARTY_PALETTE );
+	AudioClock    clock( show );
+
+	show.addDevice( &ring );
+	Clock::use( &clock );
+
+	double  started = seconds();
+
+	try
+	{
+		show.run();
+	}
+	catch ( ReplayEnd & )
+	{
+	}
+
+	double  total = seconds() - started;
+
+	Clock::use( NULL );
+
+	// Match each onset with the first beat after it.
+	int    matched = 0;
+	long   sum     = 0;
+	long   worst   = 0;
+	int    b       = 0;
+
+	for ( int o = 0 ; o < nOnsets ; ++o )
+	{
+		while ( b < nBeats && beatTimes[b] < onsets[o] )
+		{
+			++b;
+		}
+
+		if ( b < nBeats && beatTimes[b] - onsets[o] <= MAX_LATENCY_MS
+		     && ( o + 1 >= nOnsets || beatTimes[b] < onsets[o + 1] ) )
+		{
+			long  latency = (long) ( beatTimes[b] - onsets[o] );
+
+			if ( verbose )
+			{
+				printf( "onset %8lu ms  beat %8lu ms  latency %3ld ms\n", onsets[o], beatTimes[b], latency );
+			}
+
+			++matched;
+			sum += latency;
+			if ( latency > worst )
+			{
+				worst = latency;
+			}
+			++b;
+		}
+		else if ( verbose )
+		{
+			printf( "onset %8lu ms  no beat\n", onsets[o] );
+		}
+	}
+
+	printf( "%s: %ld Hz, %.1f s, %ld ADC samples\n", argv[a], wavRate, (double) wavLength / wavRate, adcLength );
+	printf( "%d onsets, %d beats, %d matched", nOnsets, nBeats, matched );
+
+	if ( matched > 0 )
+	{
+		printf( ", latency avg %ld ms max %ld ms", sum / matched, worst );
+	}
+
+	printf( "\n" );
+	printf( "analysis %.3f us per sample, light show %.3f us per frame for %ld frames\n",
+	        1e6 * feedSeconds / adcLength, ( frames > 0 ) ? 1e6 * ( total - feedSeconds ) / frames : 0.0, frames );
+
+	return 0;
+}
@@ -0,0 +1,346 @@
+/**
+ * Host side check that frames handed from a rendering thread to a sending
+ * thread are never torn: every frame the sending thread reads was written
+ * whole by the rendering thread, and the frames arrive in order.
+ *
+ * Two handoffs are checked.  The double buffer is an LedDevice with a back
+ * buffer, @see LedDevice::setBackBuffer().  The light show side renders
+ * into the back buffer and commit() swaps the pointers.  show() then hands
+ * the new front buffer to the sending thread, but first waits until that
+ * thread has sent the previous frame, since the swap has just given that
+ * buffer back to the renderer.  The triple buffer is the TripleBuffer of
+ * the host runtime, where neither side waits.
+ *
+ * Every LED unit of a frame holds the frame number and a value that
+ * depends on the position of the LED unit.  Both threads yield part way
+ * through each frame, the sending thread more often, so that even on a
+ * single core the renderer overtakes a sending thread reading the same
+ * buffer.
+ *
+ * Building, with FastLED built for its host (stub) platform:
+ *
+ *     g++ -std=gnu++11 -O2 -pthread -Iextras/host -I$FASTLED/src -o BufferCheck \
+ *         extras/BufferCheck.cpp extras/host/Arduino.cpp \
+ *         $(ls *.cpp | grep -v StripTease.cpp) $FASTLED_OBJECTS
+ *     ./BufferCheck
+ *
+ * Options:
+ *
+ *     -n leds      The number of LEDs, default 300.
+ *     -f frames    The number of frames rendered by each check, default
+ *                  20000.
+ *     -u           Leave out the wait in show() of the double buffer, to
+ *                  show that the check finds the torn frames that follow.
+ *
+ * Exits with 1 if any frame was torn or out of order.
+ *
+ *  @date   Created on October 18, 2026
+ *  @author Steven F. LeBrun
+ *  <br/><br/>
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <atomic>
+#include <thread>
+
+#include <Arduino.h>
+
+#include "../LedDevice.h"
+#include "host/TripleBuffer.h"
+
+/**
+ * The number of LED units drawn between yields to the sending thread.
+ */
+#define  RENDER_YIELD_EVERY  16
+
+/**
+ * The number of LED units checked between yields to the rendering thread.
+ */
+#define  SEND_YIELD_EVERY    5
+
+// Needed by the light shows, normally defined by the sketch.
+volatile bool           mode_change = false;
+volatile unsigned long  lastTime    = 0;
+
+void yield()
+{
+}
+
+/**
+ * @return Returns the color of LED unit @b i in frame @b n.
+ */
+static CRGB frameColor( unsigned long n, int i )
+{
+	return CRGB( n & 0xFF, ( n >> 8 ) & 0xFF, ( n + i ) & 0xFF );
+}
+
+/**
+ * Draws frame @b n, as a light show would.
+ */
+static void render( CRGB * leds, int nLEDs, unsigned long n )
+{
+	int  i;
+
+	for ( i = 0 ; i < nLEDs ; ++i )
+	{
+		leds[i] = frameColor( n, i );
+
+		if ( i % RENDER_YIELD_EVERY == RENDER_YIELD_EVERY - 1 )
+		{
+			std::this_thread::yield();
+		}
+	}
+}
+
+/**
+ * What the sending thread has seen.
+ */
+struct Tally
+{
+	unsigned long  frames;
+	unsigned long  torn;
+	unsigned long  outOfOrder;
+
+	/**
+	 * The low 16 bits of the number of the last frame seen.
+	 */
+	uint16_t       last;
+
+	Tally() : frames(0), torn(0), outOfOrder(0), last(0) {};
+
+	/**
+	 * Checks one frame, as the sending thread would send it.
+	 */
+	void check( const CRGB * frame, int nLEDs )
+	{
+		uint16_t  n = frame[0].r | ( frame[0].g << 8 );
+		int       i;
+
+		for ( i = 0 ; i < nLEDs ; ++i )
+		{
+			if ( frame[i] != frameColor( n, i ) )
+			{
+				++torn;
+				break;
+			}
+
+			if ( i % SEND_YIELD_EVERY == SEND_YIELD_EVERY - 1 )
+			{
+				std::this_thread::yield();
+			}
+		}
+
+		// Frames are numbered from 1, so every frame is after the last.
+		if ( (uint16_t) ( n - last ) == 0 || (uint16_t) ( n - last ) >= 0x8000 )
+		{
+			++outOfOrder;
+		}
+
+		last = n;
+		++frames;
+	};
+};
+
+/**
+ * Class derived from LedDevice whose show() hands the front buffer to a
+ * sending thread rather than sending it.
+ */
+class HandoffDevice: public LedDevice
+{
+	private:
+		/**
+		 * The front buffer handed to the sending thread, or NULL once it
+		 * has been sent.
+		 */
+		std::atomic<const CRGB *>  pending;
+
+		/**
+		 * Set to @b false to hand over frames without waiting.
+		 */
+		bool                       wait;
+
+	public:
+		/**
+		 * Constructor.
+		 *
+		 * @param nLEDs   The number of LED units.
+		 * @param lights  The first color array.
+		 * @param wait    @b false to leave out the wait in show().
+		 */
+		HandoffDevice( int nLEDs, CRGB * lights, bool wait ) :
+			LedDevice(nLEDs, 0, lights), pending(NULL), wait(wait)
+		{
+		};
+
+		/**
+		 * Waits until the previous frame has been sent, then hands the
+		 * front buffer to the sending thread.
+		 */
+		virtual void show()
+		{
+			while ( wait && pending.load() != NULL )
+			{
+				std::this_thread::yield();
+			}
+
+			pending.store( front );
+		};
+
+		/**
+		 * Called by the sending thread.
+		 *
+		 * @return Returns the frame to send, or NULL if there is none.
+		 */
+		const CRGB * take() { return pending.load(); };
+
+		/**
+		 * Called by the sending thread when it has sent the frame.
+		 */
+		void sent() { pending.store( NULL ); };
+};
+
+/**
+ * Renders frames into a double buffered device and sends them on a second
+ * thread.
+ */
+static void checkDouble( int nLEDs, unsigned long nFrames, bool wait, Tally & tally )
+{
+	CRGB *             first  = new CRGB[nLEDs]();
+	CRGB *             second = new CRGB[nLEDs]();
+	HandoffDevice      device( nLEDs, first, wait );
+	std::atomic<bool>  done( false );
+	unsigned long      n;
+
+	// Every LED unit is drawn on every frame, so nothing is copied back.
+	device.setBackBuffer( second, false );
+
+	std::thread  sender( [&]()
+	{
+		for ( ; ; )
+		{
+			bool          last  = done.load();
+			const CRGB *  frame = device.take();
+
+			if ( frame != NULL )
+			{
+				tally.check( frame, nLEDs );
+				device.sent();
+			}
+			else if ( last )
+			{
+				break;
+			}
+			else
+			{
+				std::this_thread::yield();
+			}
+		}
+	} );
+
+	for ( n = 1 ; n <= nFrames ; ++n )
+	{
+		render( device.getLEDs(), nLEDs, n );
+		device.commit();
+		std::this_thread::yield();
+	}
+
+	done.store( true );
+	sender.join();
+
+	delete [] first;
+	delete [] second;
+}
+
+/**
+ * Renders frames into a TripleBuffer and takes them on a second thread.
+ */
+static void checkTriple( int nLEDs, unsigned long nFrames, Tally & tally, unsigned long & dropped )
+{
+	TripleBuffer<CRGB>  frames( nLEDs );
+	std::atomic<bool>   done( false );
+	unsigned long       n;
+
+	std::thread  sender( [&]()
+	{
+		for ( ; ; )
+		{
+			bool  last = done.load();
+
+			if ( frames.acquire() )
+			{
+				tally.check( frames.frontFrame(), nLEDs );
+			}
+			else if ( last )
+			{
+				break;
+			}
+			else
+			{
+				std::this_thread::yield();
+			}
+		}
+	} );
+
+	for ( n = 1 ; n <= nFrames ; ++n )
+	{
+		render( frames.backFrame(), nLEDs, n );
+		frames.publish();
+		std::this_thread::yield();
+	}
+
+	done.store( true );
+	sender.join();
+
+	dropped = frames.droppedFrames();
+}
+
+int main( int argc, char * argv[] )
+{
+	int            nLEDs   = 300;
+	unsigned long  nFrames = 20000;
+	bool           wait    = true;
+	int            a;
+
+	for ( a = 1 ; a < argc ; ++a )
+	{
+		if ( strcmp( argv[a], "-n" ) == 0 && a + 1 < argc )
+		{
+			nLEDs = atoi( argv[++a] );
+		}
+		else if ( strcmp( argv[a], "-f" ) == 0 && a + 1 < argc )
+		{
+			nFrames = atol( argv[++a] );
+		}
+		else if ( strcmp( argv[a], "-u" ) == 0 )
+		{
+			wait = false;
+		}
+		else
+		{
+			break;
+		}
+	}
+
+	if ( a != argc || nLEDs <= 0 || nFrames == 0 )
+	{
+		fprintf( stderr, "usage: %s [-n leds] [-f frames] [-u]\n", argv[0] );
+		return 1;
+	}
+
+	Tally          doubled;
+	Tally          tripled;
+	unsigned long  dropped = 0;
+
+	checkDouble( nLEDs, nFrames, wait, doubled );
+	checkTriple( nLEDs, nFrames, tripled, dropped );
+
+	printf( "double buffer: %lu frames rendered, %lu sent, %lu torn, %lu out of order\n",
+	        nFrames, doubled.frames, doubled.torn, doubled.outOfOrder );
+	printf( "triple buffer: %lu frames rendered, %lu sent, %lu dropped, %lu torn, %lu out of order\n",
+	        nFrames, tripled.frames, dropped, tripled.torn, tripled.outOfOrder );
+
+	return ( doubled.torn + doubled.outOfOrder + tripled.torn + tripled.outOfOrder > 0 ) ? 1 : 0;
+}
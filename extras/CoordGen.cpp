@@ -0,0 +1,99 @@
+/**
+ * Host side generator for the LED unit coordinate tables used by
+ * LedDevice::setCoordinates().
+ *
+ * Prints a PROGMEM table with the x and y position of each LED unit, in
+ * 1/LedDevice_UNITS_PER_MM millimetres, for LED units laid out along a
+ * straight line or around a circle.  The output is pasted into the source
+ * file of the device, for example:
+ *
+ *     g++ -O2 -o CoordGen extras/CoordGen.cpp
+ *     ./CoordGen line   LedStrip::COORDINATES 60 16.667 0   0
+ *     ./CoordGen circle LedRing::COORDINATES  12 15.5   500 100
+ *
+ * For a line the arguments after the count are the spacing and the
+ * position of the first LED unit; the line runs along the x axis.  For a
+ * circle they are the radius and the position of the centre; the first LED
+ * unit is at the top and the rest follow clockwise.  All values are in
+ * millimetres, with x to the right and y down.
+ *
+ *  @date   Created on October 18, 2026
+ *  @author Steven F. LeBrun
+ *  <br/><br/>
+ */
+
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+/**
+ * The number of coordinate units in a millimetre.  Must match
+ * LedDevice_UNITS_PER_MM.
+ */
+#define  UNITS_PER_MM  16
+
+/**
+ * Converts millimetres to coordinate units, checking the range.
+ */
+static int toUnits( double mm )
+{
+	long  units = lround( mm * UNITS_PER_MM );
+
+	if ( units < -32768 || units > 32767 )
+	{
+		fprintf( stderr, "%.1f mm is outside the range of a coordinate\n", mm );
+		exit( 1 );
+	}
+
+	return (int) units;
+}
+
+int main( int argc, char * argv[] )
+{
+	if ( argc != 7 )
+	{
+		fprintf( stderr, "usage: %s line|circle NAME count spacing|radius x y\n", argv[0] );
+		return 1;
+	}
+
+	bool    circle = ( strcmp( argv[1], "circle" ) == 0 );
+	int     count  = atoi( argv[3] );
+	double  size   = atof( argv[4] );
+	double  x0     = atof( argv[5] );
+	double  y0     = atof( argv[6] );
+	int     i;
+
+	if ( count < 1 )
+	{
+		fprintf( stderr, "count must be at least 1\n" );
+		return 1;
+	}
+
+	printf( "const int16_t %s[] PROGMEM =\n{\n", argv[2] );
+
+	for ( i = 0 ; i < count ; ++i )
+	{
+		double  x;
+		double  y;
+
+		if ( circle )
+		{
+			double  angle = 2.0 * M_PI * i / count;
+
+			x = x0 + size * sin( angle );
+			y = y0 - size * cos( angle );
+		}
+		else
+		{
+			x = x0 + size * i;
+			y = y0;
+		}
+
+		printf( "\t%6d, %6d%s\n", toUnits( x ), toUnits( y ), ( i + 1 < count ) ? "," : "" );
+	}
+
+	printf( "};\n" );
+
+	return 0;
+}
@@ -0,0 +1,257 @@
+/**
+ * Host side measure of how the LedDevice and LightShow classes scale to an
+ * installation of hundreds of strips.
+ *
+ * Each device is a SinkDevice with a ChecksumSink of its own, which reads
+ * every frame as a driver would and counts the time it would take on the
+ * wire, and runs a light show of its own: a rainbow, a heat palette, a
+ * sweeper or a smooth sweeper in turn.  A DeviceScheduler runs their
+ * frames on a work-stealing pool of threads, each frame due at the start of
+ * its light show's frame period.
+ *
+ * For each number of devices, strip length and number of threads it prints
+ * one line with:
+ *
+ *     the frames per second and millions of LED units per second rendered;
+ *     the latency from the time a frame was due to the time it was out,
+ *     median, 99th and 99.9th percentile and worst, in us;
+ *     the percentage of frames out after the next one was due;
+ *     the percentage of frames stolen by another thread;
+ *     the percentage of the run each thread spent on frames.
+ *
+ * Building, with FastLED built for its host (stub) platform:
+ *
+ *     g++ -std=gnu++11 -O2 -pthread -Iextras/host -I$FASTLED/src -o DeviceFarm \
+ *         extras/DeviceFarm.cpp extras/host/[A-Z]*.cpp \
+ *         $(ls *.cpp | grep -v StripTease.cpp) $FASTLED_OBJECTS
+ *     ./DeviceFarm -d 100,400,1600 -n 60,300,1000 -j 1,2,4,8
+ *
+ * Options, each a list separated by commas:
+ *
+ *     -d devices   The numbers of devices, default 100,200,400.
+ *     -n leds      The LED units per device, default 60,300,1000.
+ *     -j threads   The numbers of threads, default all the cores.
+ *     -t seconds   How long each run lasts, default 2.
+ *     -f ms        Replace the frame delay of every light show, default 20.
+ *
+ *  @date   Created on October 18, 2026
+ *  @author Steven F. LeBrun
+ *  <br/><br/>
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <thread>
+#include <vector>
+
+#include <Arduino.h>
+
+#include "../Colors.h"
+#include "../PaletteShow.h"
+#include "../Sweeper.h"
+#include "host/DeviceScheduler.h"
+#include "host/FrameSink.h"
+#include "host/SinkDevice.h"
+
+/**
+ * The largest number of values in a list option.
+ */
+#define  MAX_VALUES  16
+
+// Needed by the light shows, normally defined by the sketch.
+volatile bool           mode_change = false;
+volatile unsigned long  lastTime    = 0;
+
+void yield()
+{
+}
+
+/**
+ * Reads a list of numbers separated by commas.
+ *
+ * @return Returns the number of values read.
+ */
+static int readList( const char * text, long * values )
+{
+	int     n = 0;
+	char *  end;
+
+	while ( n < MAX_VALUES )
+	{
+		values[n] = strtol( text, &end, 10 );
+		if ( end == text || values[n] < 0 )
+		{
+			return 0;
+		}
+
+		++n;
+
+		if ( *end != ',' )
+		{
+			break;
+		}
+
+		text = end + 1;
+	}
+
+	return n;
+}
+
+/**
+ * @return Returns the light show for device n.
+ */
+static LightShow * makeShow( int n, LedDevice * device )
+{
+	int        nLEDs = device->numberOfLEDs();
+	Sweeper *  sweeper;
+
+	switch ( n % 4 )
+	{
+		case 0:
+			return new PaletteShow( device );
+
+		case 1:
+			return new PaletteShow( device, Colors::HEAT_PALETTE );
+
+		default:
+			sweeper = new Sweeper( device );
+			device->setForeground( CRGB::Purple );
+			device->setBackground( CRGB::Black );
+			sweeper->setNumLEDs( ( nLEDs > 10 ) ? nLEDs / 10 : 1 );
+			sweeper->setCycles( 0 );
+
+			if ( n % 4 == 3 )
+			{
+				sweeper->setSmooth( 30 << 8 );
+			}
+
+			return sweeper;
+	}
+}
+
+/**
+ * Builds the devices and light shows, runs them and prints the results.
+ */
+static void measure( int nDevices, int nLEDs, int nThreads, double seconds, long frameDelay )
+{
+	std::vector<ChecksumSink *>  sinks;
+	std::vector<SinkDevice *>    devices;
+	std::vector<LightShow *>     shows;
+	DeviceScheduler              scheduler;
+	int                          d;
+
+	for ( d = 0 ; d < nDevices ; ++d )
+	{
+		ChecksumSink *  sink   = new ChecksumSink();
+		SinkDevice *    device = new SinkDevice( nLEDs, sink );
+		LightShow *     show   = makeShow( d, device );
+
+		show->setFrameDelay( (unsigned long) frameDelay );
+		show->setGovernor( false );
+		scheduler.add( show );
+
+		sinks.push_back( sink );
+		devices.push_back( device );
+		shows.push_back( show );
+	}
+
+	scheduler.run( nThreads, seconds );
+
+	double  elapsed = scheduler.getSeconds();
+	double  frames  = scheduler.getFrames();
+
+	printf( "%7d  %5d  %7d  %8.0f  %7.1f  %6u  %6u  %6u  %7u  %6.2f  %6.2f ",
+	        nDevices, nLEDs, nThreads, frames / elapsed, frames * nLEDs / elapsed / 1e6,
+	        scheduler.getLatency( 0.5 ), scheduler.getLatency( 0.99 ), scheduler.getLatency( 0.999 ),
+	        scheduler.getLatency( 1.0 ),
+	        ( frames > 0 ) ? 100.0 * scheduler.getMissed() / frames : 0.0,
+	        ( frames > 0 ) ? 100.0 * scheduler.getStolen() / frames : 0.0 );
+
+	for ( int t = 0 ; t < nThreads ; ++t )
+	{
+		printf( " %3.0f", 100.0 * scheduler.getUtilization( t ) );
+	}
+
+	printf( "\n" );
+	fflush( stdout );
+
+	for ( d = nDevices - 1 ; d >= 0 ; --d )
+	{
+		delete shows[d];
+		delete devices[d];
+		delete sinks[d];
+	}
+}
+
+int main( int argc, char * argv[] )
+{
+	long    deviceCounts[MAX_VALUES] = { 100, 200, 400 };
+	long    ledCounts[MAX_VALUES]    = { 60, 300, 1000 };
+	long    threadCounts[MAX_VALUES] = { (long) std::thread::hardware_concurrency() };
+	int     nDeviceCounts = 3;
+	int     nLedCounts    = 3;
+	int     nThreadCounts = 1;
+	double  seconds       = 2;
+	long    frameDelay    = 20;
+	int     a;
+
+	if ( threadCounts[0] <= 0 )
+	{
+		threadCounts[0] = 1;
+	}
+
+	for ( a = 1 ; a + 1 < argc && argv[a][0] == '-' ; a += 2 )
+	{
+		if ( strcmp( argv[a], "-d" ) == 0 )
+		{
+			nDeviceCounts = readList( argv[a + 1], deviceCounts );
+		}
+		else if ( strcmp( argv[a], "-n" ) == 0 )
+		{
+			nLedCounts = readList( argv[a + 1], ledCounts );
+		}
+		else if ( strcmp( argv[a], "-j" ) == 0 )
+		{
+			nThreadCounts = readList( argv[a + 1], threadCounts );
+		}
+		else if ( strcmp( argv[a], "-t" ) == 0 )
+		{
+			seconds = atof( argv[a + 1] );
+		}
+		else if ( strcmp( argv[a], "-f" ) == 0 )
+		{
+			frameDelay = atol( argv[a + 1] );
+		}
+		else
+		{
+			break;
+		}
+	}
+
+	if ( a != argc || nDeviceCounts == 0 || nLedCounts == 0 || nThreadCounts == 0 || seconds <= 0 || frameDelay < 0 )
+	{
+		fprintf( stderr, "usage: %s [-d devices] [-n leds] [-j threads] [-t seconds] [-f ms]\n", argv[0] );
+		return 1;
+	}
+
+	printf( "%7s  %5s  %7s  %8s  %7s  %6s  %6s  %6s  %7s  %6s  %6s  %s\n", "devices", "leds", "threads",
+	        "frames/s", "Mleds/s", "p50_us", "p99_us", "p999_us", "max_us", "miss%", "stol%", "busy% per thread" );
+
+	for ( int i = 0 ; i < nDeviceCounts ; ++i )
+	{
+		for ( int j = 0 ; j < nLedCounts ; ++j )
+		{
+			for ( int k = 0 ; k < nThreadCounts ; ++k )
+			{
+				if ( deviceCounts[i] > 0 && ledCounts[j] > 0 && threadCounts[k] > 0 )
+				{
+					measure( (int) deviceCounts[i], (int) ledCounts[j], (int) threadCounts[k], seconds, frameDelay );
+				}
+			}
+		}
+	}
+
+	return 0;
+}
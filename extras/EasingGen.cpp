@@ -0,0 +1,149 @@
+/**
+ * Host side generator for the easing tables used by the Easing class.
+ *
+ * Prints the PROGMEM table with one row of 256 entries for each EasingCurve
+ * after EASE_LINEAR, which needs no table.  Entry i is the eased value of
+ * i / 255, scaled to 255.  The output is pasted into Easing.cpp:
+ *
+ *     g++ -O2 -o EasingGen extras/EasingGen.cpp -lm
+ *     ./EasingGen
+ *
+ * The curves must start at 0 and end at 255, must be listed in the order
+ * of the EasingCurve values, and must not change by 128 or more from one
+ * entry to the next, which Easing::ease() relies on.
+ *
+ *  @date   Created on October 18, 2026
+ *  @author Steven F. LeBrun
+ *  <br/><br/>
+ */
+
+#include <math.h>
+#include <stdio.h>
+
+/**
+ * The number of table entries printed on each line.
+ */
+#define  PER_LINE  16
+
+/**
+ * Starts slowly: x squared.
+ */
+static double easeIn( double x )
+{
+	return x * x;
+}
+
+/**
+ * Ends slowly: the mirror of easeIn().
+ */
+static double easeOut( double x )
+{
+	return 1 - ( 1 - x ) * ( 1 - x );
+}
+
+/**
+ * Starts and ends slowly: the smoothstep cubic.
+ */
+static double easeInOut( double x )
+{
+	return x * x * ( 3 - 2 * x );
+}
+
+/**
+ * Falls onto the end and bounces three times, each lower than the last.
+ */
+static double bounce( double x )
+{
+	const double  n = 7.5625;
+	const double  d = 2.75;
+
+	if ( x < 1 / d )
+	{
+		return n * x * x;
+	}
+	else if ( x < 2 / d )
+	{
+		x -= 1.5 / d;
+		return n * x * x + 0.75;
+	}
+	else if ( x < 2.5 / d )
+	{
+		x -= 2.25 / d;
+		return n * x * x + 0.9375;
+	}
+
+	x -= 2.625 / d;
+	return n * x * x + 0.984375;
+}
+
+/**
+ * A curve, with the name of its EasingCurve value.
+ */
+struct Curve
+{
+	const char *  name;
+	double        (*ease)( double );
+};
+
+static const Curve  curves[] =
+{
+	{ "EASE_IN",     easeIn },
+	{ "EASE_OUT",    easeOut },
+	{ "EASE_IN_OUT", easeInOut },
+	{ "EASE_BOUNCE", bounce }
+};
+
+int main()
+{
+	int  nCurves = sizeof(curves) / sizeof(Curve);
+	int  c;
+	int  i;
+
+	for ( c = 0 ; c < nCurves ; ++c )
+	{
+		for ( i = 0 ; i < 255 ; ++i )
+		{
+			if ( labs( lround( 255 * curves[c].ease( ( i + 1 ) / 255.0 ) )
+			           - lround( 255 * curves[c].ease( i / 255.0 ) ) ) >= 128 )
+			{
+				fprintf( stderr, "%s is too steep at entry %d\n", curves[c].name, i );
+				return 1;
+			}
+		}
+	}
+
+	printf( "const uint8_t Easing::TABLES[EASE_CURVES - 1][256] PROGMEM =\n{\n" );
+
+	for ( c = 0 ; c < nCurves ; ++c )
+	{
+		printf( "\t// %s\n\t{\n", curves[c].name );
+
+		for ( i = 0 ; i < 256 ; ++i )
+		{
+			long  value = lround( 255 * curves[c].ease( i / 255.0 ) );
+
+			if ( value < 0 )
+			{
+				value = 0;
+			}
+			else if ( value > 255 )
+			{
+				value = 255;
+			}
+
+			if ( i % PER_LINE == 0 )
+			{
+				printf( "\t\t" );
+			}
+
+			printf( "%3ld%s", value, ( i < 255 ) ? "," : "" );
+			printf( ( i % PER_LINE == PER_LINE - 1 ) ? "\n" : " " );
+		}
+
+		printf( "\t}%s\n", ( c + 1 < nCurves ) ? "," : "" );
+	}
+
+	printf( "};\n" );
+
+	return 0;
+}
@@ -0,0 +1,93 @@
+/**
+ * Host side run of the benchmarks of the sketch, @see Benchmark.h.
+ *
+ * Benchmark.cpp is built with a host compiler against the stand-in Arduino
+ * core in extras/host and run once, the same as the `b` command.  The host
+ * has the memory for every size, so the 1000 and 10,000 LED cases that an
+ * Uno reports as not run are measured as well.  The results are written
+ * as an event log, so they go through extras/LogDecoder.cpp like a capture
+ * from the board and can be compared against a saved baseline:
+ *
+ *     ./HostBenchmark | ./LogDecoder
+ *     ./HostBenchmark -o bench.bin && ./LogDecoder -j bench.bin > host.json
+ *     ./HostBenchmark | ./LogDecoder -j -b host.json
+ *
+ * Building, with FastLED built for its host (stub) platform:
+ *
+ *     g++ -std=gnu++11 -O2 -Iextras/host -I$FASTLED/src -o HostBenchmark \
+ *         extras/HostBenchmark.cpp extras/host/Arduino.cpp \
+ *         $(ls *.cpp | grep -v StripTease.cpp) $FASTLED_OBJECTS
+ *
+ * Options:
+ *
+ *     -o capture   Write the event log to a file instead of to standard
+ *                  output.
+ *
+ * The times are those of the host processor and are only comparable with
+ * other host runs.
+ *
+ *  @date   Created on October 18, 2026
+ *  @author Steven F. LeBrun
+ *  <br/><br/>
+ */
+
+#include <stdio.h>
+#include <string.h>
+
+#include <Arduino.h>
+
+#include "../Benchmark.h"
+#include "../EventLog.h"
+
+// Needed by the light shows, normally defined by the sketch.
+volatile bool           mode_change = false;
+volatile unsigned long  lastTime    = 0;
+
+void yield()
+{
+}
+
+int main( int argc, char * argv[] )
+{
+	const char *  output = NULL;
+	int           a;
+
+	for ( a = 1 ; a < argc ; ++a )
+	{
+		if ( strcmp( argv[a], "-o" ) == 0 && a + 1 < argc )
+		{
+			output = argv[++a];
+		}
+		else
+		{
+			break;
+		}
+	}
+
+	if ( a != argc )
+	{
+		fprintf( stderr, "usage: %s [-o capture]\n", argv[0] );
+		return 1;
+	}
+
+	Serial.out = ( output != NULL ) ? fopen( output, "wb" ) : stdout;
+	if ( Serial.out == NULL )
+	{
+		perror( output );
+		return 1;
+	}
+
+	Benchmark::run();
+	EventLog::flush();
+
+	if ( output != NULL )
+	{
+		fclose( Serial.out );
+	}
+	else
+	{
+		fflush( stdout );
+	}
+
+	return 0;
+}
@@ -0,0 +1,236 @@
+/**
+ * Host side runtime that renders a light show and sends its frames on two
+ * separate threads.
+ *
+ * The light show runs on the main thread with the real time of the host,
+ * as it does on a board, but its LED Device is a ThreadedDevice: show()
+ * only hands the finished frame to an output thread through a TripleBuffer
+ * and returns.  The output thread sends the newest frame to a FrameSink, a
+ * file or pipe of raw RGB bytes and optionally the time a WS2812 strip of
+ * that length takes to clock it in.  A frame that is replaced before the
+ * output thread takes it is dropped, never half written, and the light
+ * show never waits for the output.
+ *
+ * At the end it reports the frames per second rendered and sent and the
+ * number of frames dropped.
+ *
+ * Building, with FastLED built for its host (stub) platform:
+ *
+ *     g++ -std=gnu++11 -O2 -pthread -Iextras/host -I$FASTLED/src -o HostRuntime \
+ *         extras/HostRuntime.cpp extras/host/[A-Z]*.cpp \
+ *         $(ls *.cpp | grep -v StripTease.cpp) $FASTLED_OBJECTS
+ *     ./HostRuntime -n 300 -w -o - palette | ffplay -f rawvideo -pixel_format rgb24 \
+ *         -video_size 300x1 -
+ *
+ * Options:
+ *
+ *     -n leds      The number of LEDs, default 300.
+ *     -t seconds   How long to run, default 5.
+ *     -d ms        Replace the frame delay of the light show, 0 renders as
+ *                  fast as the host can.
+ *     -o file      Write the frames to a file, '-' for the standard output.
+ *     -w           Take the time a WS2812 strip needs for each frame.
+ *
+ * The light show is one of sweeper, sparkle, palette, particles or fill,
+ * default palette.
+ *
+ *  @date   Created on October 18, 2026
+ *  @author Steven F. LeBrun
+ *  <br/><br/>
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include <chrono>
+#include <thread>
+
+#include <Arduino.h>
+
+#include "../FillSolid.h"
+#include "../LightShow.h"
+#include "../PaletteShow.h"
+#include "../ParticleSparkle.h"
+#include "../SparkleLEDs.h"
+#include "../Sweeper.h"
+#include "host/FrameSink.h"
+#include "host/ThreadedDevice.h"
+
+// Needed by the light shows, normally defined by the sketch.
+volatile bool           mode_change = false;
+volatile unsigned long  lastTime    = 0;
+
+void yield()
+{
+}
+
+static double seconds()
+{
+	struct timespec  ts;
+
+	clock_gettime( CLOCK_MONOTONIC, &ts );
+
+	return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+/**
+ * Ends the light show after the given time, as a press of the mode button
+ * would.
+ */
+static void stopAfter( double limit )
+{
+	std::this_thread::sleep_for( std::chrono::microseconds( (long long) ( limit * 1e6 ) ) );
+
+	mode_change = true;
+}
+
+/**
+ * @return Returns the light show with the given name on the device, or
+ *         NULL if there is none.
+ */
+static LightShow * makeShow( const char * name, LedDevice * device )
+{
+	if ( strcmp( name, "sweeper" ) == 0 )
+	{
+		Sweeper *  sweeper = new Sweeper( device );
+
+		device->setForeground( CRGB::Purple );
+		device->setBackground( CRGB::Black );
+		sweeper->setNumLEDs( 10 );
+		sweeper->setCycles( 0 );
+
+		return sweeper;
+	}
+
+	if ( strcmp( name, "sparkle" ) == 0 )
+	{
+		return new SparkleLEDs( device );
+	}
+
+	if ( strcmp( name, "palette" ) == 0 )
+	{
+		return new PaletteShow( device );
+	}
+
+	if ( strcmp( name, "particles" ) == 0 )
+	{
+		return new ParticleSparkle( device );
+	}
+
+	if ( strcmp( name, "fill" ) == 0 )
+	{
+		return new FillSolid( CRGB::White, CRGB::Black, device );
+	}
+
+	return NULL;
+}
+
+int main( int argc, char * argv[] )
+{
+	int           nLEDs      = 300;
+	double        limit      = 5;
+	long          frameDelay = -1;
+	const char *  output     = NULL;
+	bool          wire       = false;
+	const char *  name       = "palette";
+	int           a;
+
+	for ( a = 1 ; a < argc && argv[a][0] == '-' && argv[a][1] != '\0' ; ++a )
+	{
+		if ( strcmp( argv[a], "-n" ) == 0 && a + 1 < argc )
+		{
+			nLEDs = atoi( argv[++a] );
+		}
+		else if ( strcmp( argv[a], "-t" ) == 0 && a + 1 < argc )
+		{
+			limit = atof( argv[++a] );
+		}
+		else if ( strcmp( argv[a], "-d" ) == 0 && a + 1 < argc )
+		{
+			frameDelay = atol( argv[++a] );
+		}
+		else if ( strcmp( argv[a], "-o" ) == 0 && a + 1 < argc )
+		{
+			output = argv[++a];
+		}
+		else if ( strcmp( argv[a], "-w" ) == 0 )
+		{
+			wire = true;
+		}
+		else
+		{
+			break;
+		}
+	}
+
+	if ( a < argc )
+	{
+		name = argv[a++];
+	}
+
+	if ( a != argc || nLEDs <= 0 || limit <= 0 )
+	{
+		fprintf( stderr, "usage: %s [-n leds] [-t seconds] [-d ms] [-o file] [-w] [show]\n", argv[0] );
+		return 1;
+	}
+
+	FILE *  out = NULL;
+
+	if ( output != NULL )
+	{
+		out = ( strcmp( output, "-" ) == 0 ) ? stdout : fopen( output, "wb" );
+		if ( out == NULL )
+		{
+			perror( output );
+			return 1;
+		}
+	}
+
+	FileSink        file( out );
+	WireSink        timed( &file );
+	FrameSink *     sink = wire ? (FrameSink *) &timed : (FrameSink *) &file;
+	ThreadedDevice  device( nLEDs, sink );
+	LightShow *     show = makeShow( name, &device );
+
+	if ( show == NULL )
+	{
+		fprintf( stderr, "%s: unknown light show, use sweeper, sparkle, palette, particles or fill\n", name );
+		return 1;
+	}
+
+	if ( frameDelay >= 0 )
+	{
+		show->setFrameDelay( (unsigned long) frameDelay );
+	}
+
+	device.begin();
+
+	double       started = seconds();
+	std::thread  timer( stopAfter, limit );
+
+	while ( ! mode_change )
+	{
+		show->run();
+	}
+
+	double  elapsed = seconds() - started;
+
+	timer.join();
+	device.end();
+
+	if ( out != NULL && out != stdout )
+	{
+		fclose( out );
+	}
+
+	fprintf( stderr, "%s on %d LEDs for %.2f s%s\n", name, nLEDs, elapsed, wire ? ", WS2812 timing" : "" );
+	fprintf( stderr, "rendered %lu frames, %.1f fps\n", device.renderedFrames(), device.renderedFrames() / elapsed );
+	fprintf( stderr, "sent     %lu frames, %.1f fps\n", device.sentFrames(), device.sentFrames() / elapsed );
+	fprintf( stderr, "dropped  %lu frames\n", device.droppedFrames() );
+
+	delete show;
+
+	return 0;
+}
@@ -0,0 +1,488 @@
+/**
+ * Host side decoder for the binary event log written by the EventLog class.
+ *
+ * Reads a capture of the Arduino serial stream and prints one line of text
+ * per record.  The capture can be read from a file or from standard input,
+ * for example:
+ *
+ *     g++ -O2 -o LogDecoder extras/LogDecoder.cpp
+ *     stty -F /dev/ttyACM0 9600 raw && ./LogDecoder < /dev/ttyACM0
+ *
+ * Options:
+ *
+ *     -j            Only print benchmark results, as a JSON array.
+ *     -b baseline   Compare benchmark results with a file written by -j.
+ *     -t            Only print mode button edges, as a trace for
+ *                   extras/TraceReplay.cpp.
+ *
+ * This program is built with a host compiler and is not part of the
+ * Arduino sketch.  It shares the record format with the sketch through
+ * EventLogFormat.h.
+ *
+ *  @date   Created on October 18, 2026
+ *  @author Steven F. LeBrun
+ *  <br/><br/>
+ */
+
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "../EventLogFormat.h"
+
+/**
+ * Describes how to print one kind of record.
+ */
+struct EventInfo
+{
+	/**
+	 * The name printed for the event.
+	 */
+	const char * name;
+
+	/**
+	 * The names of the arguments, separated by spaces.  A name ending in
+	 * ":32" takes two arguments, low word first, holding a 32 bit value.
+	 * Arguments without a name are printed by position.
+	 */
+	const char * args;
+};
+
+/**
+ * The table of events, indexed by LogEvent value.
+ */
+static const EventInfo  events[] =
+{
+	{ "DROPPED",     "count" },
+	{ "TIME",        "ms:32" },
+	{ "BOOT",        "" },
+	{ "MODE_CHANGE", "mode" },
+	{ "SHOW_START",  "show leds" },
+	{ "SPARKLE",     "changed" },
+	{ "PERF_SHOW",   "show frames:32 late skipped quality" },
+	{ "PERF_RENDER", "show min_us avg_us max_us" },
+	{ "PERF_DEVICE", "pin shows:32 setLED:32 wire_us" },
+	{ "PERF_OUTPUT", "pin min_us avg_us max_us" },
+	{ "BENCH",       "case leds iterations:32 ns:32" },
+	{ "BENCH",       "case leds iterations:32 cycles:32" },
+	{ "PERF_LAYER",  "layer min_us avg_us max_us" },
+	{ "MODE_SWITCH", "show us" },
+	{ "QUALITY",     "show quality busy_us frame_ms" },
+	{ "BUTTON",      "ms:32 mode accepted" },
+	{ "PROGRAM",     "bytes" },
+	{ "MEMORY",      "free least_free" }
+};
+
+static const int  MAX_EVENTS = sizeof(events) / sizeof(EventInfo);
+
+/**
+ * The names of the light shows, indexed by ShowType value.
+ */
+static const char * shows[] =
+{
+	"unknown",
+	"FillAndClear",
+	"Sweeper",
+	"Sparkle",
+	"Compositor",
+	"Palette",
+	"ParticleSparkle",
+	"Sweeper2D",
+	"Spatial",
+	"SweeperShader",
+	"FillSolidShader",
+	"Audio",
+	"Program"
+};
+
+static const int  MAX_SHOWS = sizeof(shows) / sizeof(char *);
+
+/**
+ * The names of the frame governor levels, indexed by QualityLevel value.
+ */
+static const char * qualities[] =
+{
+	"full",
+	"reduced",
+	"half_rate",
+	"quarter_rate"
+};
+
+static const int  MAX_QUALITIES = sizeof(qualities) / sizeof(char *);
+
+/**
+ * The names of the benchmarks, indexed by BenchCase value.
+ */
+static const char * benches[] =
+{
+	"setLEDs",
+	"advanceLEDs",
+	"retreatLEDs",
+	"setLED_loop",
+	"Sweeper_frame",
+	"FillSolid_frame",
+	"SparkleLEDs_frame",
+	"Colors_nextColor",
+	"Colors_randomJustColor",
+	"Colors_fillPalette",
+	"Colors_hsvColor",
+	"hsv2rgb_rainbow",
+	"hsv2rgb_spectrum",
+	"ParticleSparkle_frame",
+	"StaticFillSolid_frame",
+	"StaticFillSolid_virtual",
+	"commit",
+	"commit_calibrated",
+	"XYMap_table",
+	"XYMap_computed",
+	"SweeperShader_shade",
+	"FillSolidShader_shade",
+	"ProgramShow_sweeper",
+	"commit_dimmed",
+	"rgbw_min",
+	"rgbw_calibrated",
+	"Animator_update"
+};
+
+static const int  MAX_BENCHES = sizeof(benches) / sizeof(char *);
+
+/**
+ * One benchmark result read from a baseline file.
+ */
+struct BenchResult
+{
+	char           name[32];
+	char           unit[8];
+	int            leds;
+	unsigned long  value;
+};
+
+/**
+ * The largest number of results that can be read from a baseline file.
+ */
+#define  MAX_BASELINE  256
+
+static BenchResult  baseline[MAX_BASELINE];
+static int          nBaseline = 0;
+
+/**
+ * Set by the -j option.
+ */
+static bool         jsonOnly  = false;
+
+/**
+ * Set by the -t option.
+ */
+static bool         traceOnly = false;
+
+/**
+ * The number of JSON results printed so far, used to place commas.
+ */
+static int          nJson     = 0;
+
+/**
+ * Tracks the absolute time of the records.  Record timestamps only hold the
+ * low 16 bits of millis(), so wraps are counted whenever a timestamp goes
+ * backwards and corrected by LOG_TIME records.
+ */
+static uint32_t  lastStamp = 0;
+
+static uint32_t unwrap( uint16_t stamp )
+{
+	uint32_t  now = ( lastStamp & 0xFFFF0000UL ) | stamp;
+
+	if ( now < lastStamp )
+	{
+		now += 0x10000UL;
+	}
+
+	lastStamp = now;
+	return now;
+}
+
+/**
+ * Reads a file of benchmark results written with the -j option.
+ */
+static bool readBaseline( const char * path )
+{
+	FILE * in = fopen( path, "r" );
+	char   line[256];
+
+	if ( in == NULL )
+	{
+		perror( path );
+		return false;
+	}
+
+	while ( fgets( line, sizeof(line), in ) != NULL && nBaseline < MAX_BASELINE )
+	{
+		BenchResult &  r = baseline[nBaseline];
+		unsigned long  iterations;
+		const char *   start = line + strspn( line, " ," );
+
+		if ( sscanf( start, "{\"case\": \"%31[^\"]\", \"leds\": %d, \"iterations\": %lu, \"%7[^\"]\": %lu}",
+		             r.name, &r.leds, &iterations, r.unit, &r.value ) == 5 )
+		{
+			++nBaseline;
+		}
+	}
+
+	fclose( in );
+	return true;
+}
+
+static const BenchResult * findBaseline( const char * name, int leds, const char * unit )
+{
+	for ( int i = 0 ; i < nBaseline ; ++i )
+	{
+		if ( baseline[i].leds == leds && strcmp( baseline[i].name, name ) == 0
+		     && strcmp( baseline[i].unit, unit ) == 0 )
+		{
+			return &baseline[i];
+		}
+	}
+
+	return NULL;
+}
+
+/**
+ * Prints a LOG_BENCH or LOG_BENCH_CYCLES record, as JSON with -j and
+ * with the change from the baseline with -b.
+ */
+static void printBench( uint32_t now, uint8_t event, int nArgs, const uint16_t * args )
+{
+	const char *   unit = ( event == LOG_BENCH_CYCLES ) ? "cycles" : "ns";
+	const char *   name = ( args[0] < MAX_BENCHES ) ? benches[args[0]] : "unknown";
+	int            leds = args[1];
+
+	if ( nArgs < 6 )
+	{
+		if ( ! jsonOnly )
+		{
+			printf( "%10lu ms  BENCH         %s  leds=%d  not run, out of memory\n",
+			        (unsigned long) now, name, leds );
+		}
+		return;
+	}
+
+	unsigned long  iterations = (unsigned long) args[2] | ( (unsigned long) args[3] << 16 );
+	unsigned long  value      = (unsigned long) args[4] | ( (unsigned long) args[5] << 16 );
+
+	if ( jsonOnly )
+	{
+		printf( "%s{\"case\": \"%s\", \"leds\": %d, \"iterations\": %lu, \"%s\": %lu}\n",
+		        ( nJson++ == 0 ) ? "" : ",", name, leds, iterations, unit, value );
+		return;
+	}
+
+	printf( "%10lu ms  BENCH         %-22s  leds=%-5d  %s=%lu", (unsigned long) now, name, leds, unit, value );
+
+	const BenchResult * base = findBaseline( name, leds, unit );
+
+	if ( base != NULL && base->value > 0 )
+	{
+		printf( "  baseline=%lu  change=%+.1f%%", base->value,
+		        100.0 * ( (double) value - (double) base->value ) / (double) base->value );
+	}
+
+	printf( "\n" );
+}
+
+static void printRecord( uint8_t event, uint16_t stamp, int nArgs, const uint16_t * args )
+{
+	uint32_t      now  = unwrap( stamp );
+	const char *  list = ( event < MAX_EVENTS ) ? events[event].args : "";
+	int           i    = 0;
+
+	if ( event == LOG_TIME && nArgs == 2 )
+	{
+		lastStamp = (uint32_t) args[0] | ( (uint32_t) args[1] << 16 );
+		now = lastStamp;
+	}
+
+	if ( traceOnly )
+	{
+		if ( event == LOG_BUTTON && nArgs == 4 )
+		{
+			printf( "%lu %u %u\n", (unsigned long) args[0] | ( (unsigned long) args[1] << 16 ), args[2], args[3] );
+		}
+		return;
+	}
+
+	if ( ( event == LOG_BENCH || event == LOG_BENCH_CYCLES ) && nArgs >= 2 )
+	{
+		printBench( now, event, nArgs, args );
+		return;
+	}
+
+	if ( jsonOnly )
+	{
+		return;
+	}
+
+	if ( event < MAX_EVENTS )
+	{
+		printf( "%10lu ms  %-12s", (unsigned long) now, events[event].name );
+	}
+	else
+	{
+		printf( "%10lu ms  EVENT_%-6u", (unsigned long) now, event );
+	}
+
+	while ( i < nArgs )
+	{
+		char    name[24];
+		size_t  len = strcspn( list, " " );
+
+		if ( len >= sizeof(name) )
+		{
+			len = sizeof(name) - 1;
+		}
+
+		memcpy( name, list, len );
+		name[len] = '\0';
+		list += len;
+		while ( *list == ' ' )
+		{
+			++list;
+		}
+
+		char *  wide = strstr( name, ":32" );
+
+		if ( len == 0 )
+		{
+			printf( "  arg%d=%u", i, args[i] );
+			++i;
+		}
+		else if ( wide != NULL && i + 1 < nArgs )
+		{
+			*wide = '\0';
+			printf( "  %s=%lu", name, (unsigned long) args[i] | ( (unsigned long) args[i + 1] << 16 ) );
+			i += 2;
+		}
+		else if ( strcmp( name, "show" ) == 0 && args[i] < MAX_SHOWS )
+		{
+			printf( "  %s=%s", name, shows[args[i]] );
+			++i;
+		}
+		else if ( strcmp( name, "quality" ) == 0 && args[i] < MAX_QUALITIES )
+		{
+			printf( "  %s=%s", name, qualities[args[i]] );
+			++i;
+		}
+		else
+		{
+			printf( "  %s=%u", name, args[i] );
+			++i;
+		}
+	}
+
+	printf( "\n" );
+}
+
+int main( int argc, char * argv[] )
+{
+	FILE * in = stdin;
+	int    a;
+
+	for ( a = 1 ; a < argc && argv[a][0] == '-' ; ++a )
+	{
+		if ( strcmp( argv[a], "-j" ) == 0 )
+		{
+			jsonOnly = true;
+		}
+		else if ( strcmp( argv[a], "-t" ) == 0 )
+		{
+			traceOnly = true;
+		}
+		else if ( strcmp( argv[a], "-b" ) == 0 && a + 1 < argc )
+		{
+			if ( ! readBaseline( argv[++a] ) )
+			{
+				return 1;
+			}
+		}
+		else
+		{
+			fprintf( stderr, "usage: %s [-j | -t] [-b baseline.json] [capture]\n", argv[0] );
+			return 1;
+		}
+	}
+
+	if ( a < argc )
+	{
+		in = fopen( argv[a], "rb" );
+		if ( in == NULL )
+		{
+			perror( argv[a] );
+			return 1;
+		}
+	}
+
+	if ( jsonOnly )
+	{
+		printf( "[\n" );
+	}
+	else if ( traceOnly )
+	{
+		printf( "# ms mode accepted\n" );
+	}
+
+	uint8_t   record[EventLog_HEADER_SIZE + 2 * EventLog_MAX_ARGS];
+	uint16_t  args[EventLog_MAX_ARGS];
+	long      skipped = 0;
+	int       c;
+
+	while ( ( c = fgetc( in ) ) != EOF )
+	{
+		// Hunt for the start of a record.  Bytes outside a record are text
+		// written by other code or the tail of a record that was cut off.
+		if ( c != EventLog_SYNC )
+		{
+			++skipped;
+			continue;
+		}
+
+		if ( fread( record + 1, 1, 2, in ) != 2 )
+		{
+			break;
+		}
+
+		int  nArgs = record[2];
+
+		if ( nArgs > EventLog_MAX_ARGS )
+		{
+			++skipped;
+			continue;
+		}
+
+		if ( fread( record + 3, 1, 2 + 2 * nArgs, in ) != (size_t) ( 2 + 2 * nArgs ) )
+		{
+			break;
+		}
+
+		for ( int i = 0 ; i < nArgs ; ++i )
+		{
+			args[i] = record[5 + 2*i] | ( record[6 + 2*i] << 8 );
+		}
+
+		printRecord( record[1], record[3] | ( record[4] << 8 ), nArgs, args );
+	}
+
+	if ( jsonOnly )
+	{
+		printf( "]\n" );
+	}
+
+	if ( skipped > 0 )
+	{
+		fprintf( stderr, "%ld bytes outside of records were skipped\n", skipped );
+	}
+
+	if ( in != stdin )
+	{
+		fclose( in );
+	}
+
+	return 0;
+}
@@ -0,0 +1,164 @@
+/**
+ * Host side measure of the time to show a frame of a long strip on one
+ * data line against the same strip split across several, @see
+ * LedParallelStrip.
+ *
+ * The device is a SinkDevice whose sink is a ParallelWireSink, which takes
+ * as long as each segment takes on the wire, 30 us per LED unit and the
+ * latch, either one segment after the other as on AVR or with one thread
+ * per data line as with the parallel drivers of a Teensy 4 or an ESP32.
+ * Each frame is drawn by a Sweeper and the time of LedDevice::commit() is
+ * measured with the real time of the host.
+ *
+ * For one data line and for each number of segments sent one after the
+ * other and in parallel it prints one line with:
+ *
+ *     the estimated wire time, @see LedDevice::wireTime();
+ *     the measured average and longest frame time;
+ *     how many times faster than one data line the average is.
+ *
+ * Building, with FastLED built for its host (stub) platform:
+ *
+ *     g++ -std=gnu++11 -O2 -pthread -Iextras/host -I$FASTLED/src -o ParallelWire \
+ *         extras/ParallelWire.cpp extras/host/[A-Z]*.cpp \
+ *         $(ls *.cpp | grep -v StripTease.cpp) $FASTLED_OBJECTS
+ *     ./ParallelWire -n 1200 -s 4
+ *
+ * Options:
+ *
+ *     -n leds      The number of LED units in the strip, default 1200.
+ *     -s segments  The largest number of data lines, default 4, as for
+ *                  LedParallelStrip_SEGMENTS.
+ *     -f frames    The number of frames shown for each line, default 50.
+ *
+ *  @date   Created on October 18, 2026
+ *  @author Steven F. LeBrun
+ *  <br/><br/>
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <Arduino.h>
+
+#include "../BufferDevice.h"
+#include "../Sweeper.h"
+#include "host/ParallelWireSink.h"
+#include "host/SinkDevice.h"
+
+// Needed by the light shows, normally defined by the sketch.
+volatile bool           mode_change = false;
+volatile unsigned long  lastTime    = 0;
+
+void yield()
+{
+}
+
+/**
+ * The average frame time of one data line, the base of the speed up.
+ */
+static double  oneLine = 0.0;
+
+/**
+ * Shows a number of frames through a ParallelWireSink and prints one line
+ * of the results.
+ *
+ * @param nLEDs     The number of LED units.
+ * @param segments  The number of data lines.
+ * @param parallel  @b true if the lines send at the same time.
+ * @param nFrames   The number of frames.
+ */
+static void measure( int nLEDs, int segments, bool parallel, int nFrames )
+{
+	ParallelWireSink  sink( segments, parallel );
+	SinkDevice        device( nLEDs, &sink );
+	Sweeper           sweep( &device );
+	CRGB *            scratch = new CRGB[nLEDs];
+	BufferDevice      estimate( nLEDs, scratch );
+	unsigned long     total   = 0;
+	unsigned long     longest = 0;
+	int               f;
+
+	// Segments sent one after the other take as long as the whole strip.
+	estimate.setSegments( parallel ? segments : 1 );
+
+	sweep.setNumLEDs( nLEDs / 6 );
+	sweep.setCycles( 0 );
+	sweep.start();
+
+	for ( f = 0 ; f < nFrames ; ++f )
+	{
+		sweep.nextFrame();
+
+		unsigned long  start = micros();
+
+		device.commit();
+
+		unsigned long  elapsed = micros() - start;
+
+		total  += elapsed;
+		longest = ( elapsed > longest ) ? elapsed : longest;
+	}
+
+	double  average = (double) total / nFrames;
+
+	if ( segments == 1 )
+	{
+		oneLine = average;
+	}
+
+	printf( "%5d  %-8s  %11lu  %11.0f  %7lu  %6.2f\n",
+	        segments, ( segments == 1 ) ? "single" : parallel ? "parallel" : "serial",
+	        estimate.wireTime(), average, longest, oneLine / average );
+
+	delete [] scratch;
+}
+
+int main( int argc, char * argv[] )
+{
+	int  nLEDs    = 1200;
+	int  segments = 4;
+	int  nFrames  = 50;
+	int  a;
+	int  s;
+
+	for ( a = 1 ; a < argc ; ++a )
+	{
+		if ( strcmp( argv[a], "-n" ) == 0 && a + 1 < argc )
+		{
+			nLEDs = atoi( argv[++a] );
+		}
+		else if ( strcmp( argv[a], "-s" ) == 0 && a + 1 < argc )
+		{
+			segments = atoi( argv[++a] );
+		}
+		else if ( strcmp( argv[a], "-f" ) == 0 && a + 1 < argc )
+		{
+			nFrames = atoi( argv[++a] );
+		}
+		else
+		{
+			break;
+		}
+	}
+
+	if ( a != argc || nLEDs <= 0 || segments <= 0 || nFrames <= 0 )
+	{
+		fprintf( stderr, "usage: %s [-n leds] [-s segments] [-f frames]\n", argv[0] );
+		return 1;
+	}
+
+	printf( "%d LED units, %d frames each\n", nLEDs, nFrames );
+	printf( " pins  output    estimate_us   average_us   max_us  speedup\n" );
+
+	measure( nLEDs, 1, false, nFrames );
+
+	for ( s = 2 ; s <= segments ; ++s )
+	{
+		measure( nLEDs, s, false, nFrames );
+		measure( nLEDs, s, true,  nFrames );
+	}
+
+	return 0;
+}
@@ -0,0 +1,519 @@
+/**
+ * Host side assembler for the light show programs run by the ProgramShow
+ * class.
+ *
+ * Reads a program written one instruction per line and writes the program
+ * image, either as binary for the EEPROM of the board or as a C array for
+ * flash.  For example:
+ *
+ *     g++ -O2 -o ShowAssembler extras/ShowAssembler.cpp
+ *     stty -F /dev/ttyACM0 9600 raw
+ *     ./ShowAssembler -s /dev/ttyACM0 extras/programs/twinkle.lss
+ *
+ *     ./ShowAssembler -c SWEEPER_PROGRAM extras/programs/sweeper.lss
+ *
+ * Options:
+ *
+ *     -o file   Write the image to a file instead of standard output.
+ *     -c name   Write the image as a C array of that name, in PROGMEM.
+ *     -s port   Send the image to the sketch, after the l command, slowly
+ *               enough for each byte to be written to EEPROM before the
+ *               serial buffer of the board fills.
+ *
+ * Each line holds an optional label ending in ':', an instruction and its
+ * operands separated by commas, and a comment starting with ';'.  The
+ * instructions are the opcodes of ShowProgramFormat.h in lower case,
+ * except that add and sub take either a register or a value:
+ *
+ *     end                    wait n                 fill #rrggbb
+ *     fill_fg                fill_bg                set r, #rrggbb
+ *     set_fg r               set_bg r               advance
+ *     retreat                palette r, r           random r, r
+ *     load r, imm            add r, imm             add r, r
+ *     sub r, r               move r, r              leds r
+ *     loop r, label          jump label             push r
+ *     pop r
+ *
+ * Registers are r0 to r7.  Values are decimal, or hexadecimal with 0x.
+ *
+ * This program is built with a host compiler and is not part of the
+ * Arduino sketch.  It shares the byte code with the sketch through
+ * ShowProgramFormat.h.
+ *
+ *  @date   Created on October 18, 2026
+ *  @author Steven F. LeBrun
+ *  <br/><br/>
+ */
+
+#include <ctype.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+#include "../ShowProgramFormat.h"
+
+/**
+ * The largest program, the EEPROM of an Arduino Uno less the header.
+ */
+#define  MAX_CODE     ( 1024 - ShowProgram_HEADER_SIZE )
+
+/**
+ * The time between bytes sent with -s, in microseconds.  Writing a byte of
+ * EEPROM takes 3.3 ms.
+ */
+#define  SEND_GAP_US  4000
+
+/**
+ * The largest number of labels.
+ */
+#define  MAX_LABELS   256
+
+/**
+ * The largest number of operands of an instruction.
+ */
+#define  MAX_OPERANDS 4
+
+/**
+ * Describes one form of an instruction.
+ */
+struct OpInfo
+{
+	/**
+	 * The name of the instruction.
+	 */
+	const char * name;
+
+	/**
+	 * The opcode written.
+	 */
+	uint8_t      opcode;
+
+	/**
+	 * One letter per operand: r for a register, n for a byte, i for a 16
+	 * bit value, a for a label and c for a color.
+	 */
+	const char * operands;
+};
+
+/**
+ * The table of instructions.  An instruction with more than one form is
+ * listed once per form.
+ */
+static const OpInfo  ops[] =
+{
+	{ "end",      OP_END,      "" },
+	{ "wait",     OP_WAIT,     "n" },
+	{ "fill",     OP_FILL,     "c" },
+	{ "fill_fg",  OP_FILL_FG,  "" },
+	{ "fill_bg",  OP_FILL_BG,  "" },
+	{ "set",      OP_SET,      "rc" },
+	{ "set_fg",   OP_SET_FG,   "r" },
+	{ "set_bg",   OP_SET_BG,   "r" },
+	{ "advance",  OP_ADVANCE,  "" },
+	{ "retreat",  OP_RETREAT,  "" },
+	{ "palette",  OP_PALETTE,  "rr" },
+	{ "random",   OP_RANDOM,   "rr" },
+	{ "load",     OP_LOAD,     "ri" },
+	{ "add",      OP_ADD_REG,  "rr" },
+	{ "add",      OP_ADD,      "ri" },
+	{ "sub",      OP_SUB_REG,  "rr" },
+	{ "move",     OP_MOVE,     "rr" },
+	{ "leds",     OP_LEDS,     "r" },
+	{ "loop",     OP_LOOP,     "ra" },
+	{ "jump",     OP_JUMP,     "a" },
+	{ "push",     OP_PUSH,     "r" },
+	{ "pop",      OP_POP,      "r" }
+};
+
+static const int  nOps = sizeof(ops) / sizeof(ops[0]);
+
+/**
+ * A label and the offset of the instruction it names.
+ */
+struct Label
+{
+	char      name[32];
+	uint16_t  offset;
+};
+
+static Label    labels[MAX_LABELS];
+static int      nLabels = 0;
+static uint8_t  code[MAX_CODE];
+static int      nCode   = 0;
+static int      errors  = 0;
+
+static void error( const char * path, int line, const char * message, const char * detail )
+{
+	fprintf( stderr, "%s:%d: %s '%s'\n", path, line, message, detail );
+	++errors;
+}
+
+static int findLabel( const char * name )
+{
+	for ( int l = 0 ; l < nLabels ; ++l )
+	{
+		if ( strcmp( labels[l].name, name ) == 0 )
+		{
+			return l;
+		}
+	}
+
+	return -1;
+}
+
+/**
+ * @return Returns the register number of an operand, or -1 if it is not
+ *         a register.
+ */
+static int registerOf( const char * operand )
+{
+	char *  end;
+
+	if ( tolower( operand[0] ) != 'r' || ! isdigit( (unsigned char) operand[1] ) )
+	{
+		return -1;
+	}
+
+	long  r = strtol( operand + 1, &end, 10 );
+
+	return ( *end == '\0' && r < ShowProgram_REGISTERS ) ? (int) r : -1;
+}
+
+/**
+ * Reads a number, decimal or hexadecimal.
+ *
+ * @return Returns true if the whole operand is a number.
+ */
+static bool numberOf( const char * operand, long & value )
+{
+	char *  end;
+
+	value = strtol( operand, &end, 0 );
+
+	return ( end != operand && *end == '\0' );
+}
+
+/**
+ * @return Returns true if the operands fit this form of the instruction.
+ */
+static bool matches( const OpInfo & op, char ** operands, int nOperands )
+{
+	long  value;
+
+	if ( (int) strlen( op.operands ) != nOperands )
+	{
+		return false;
+	}
+
+	for ( int o = 0 ; o < nOperands ; ++o )
+	{
+		switch ( op.operands[o] )
+		{
+			case 'r':
+				if ( registerOf( operands[o] ) < 0 )
+				{
+					return false;
+				}
+				break;
+
+			case 'n':
+			case 'i':
+				if ( ! numberOf( operands[o], value ) )
+				{
+					return false;
+				}
+				break;
+
+			default:
+				// Labels and colors are checked when they are written.
+				if ( registerOf( operands[o] ) >= 0 )
+				{
+					return false;
+				}
+				break;
+		}
+	}
+
+	return true;
+}
+
+/**
+ * Assembles one pass over the source.  The first pass only finds the
+ * labels, the second writes the code.
+ */
+static void assemble( const char * path, FILE * in, bool write )
+{
+	char  text[256];
+	int   line = 0;
+
+	nCode = 0;
+
+	while ( fgets( text, sizeof(text), in ) != NULL )
+	{
+		char *  operands[MAX_OPERANDS];
+		int     nOperands = 0;
+		char *  p;
+
+		++line;
+
+		if ( ( p = strchr( text, ';' ) ) != NULL )
+		{
+			*p = '\0';
+		}
+
+		p = text;
+
+		while ( isspace( (unsigned char) *p ) )
+		{
+			++p;
+		}
+
+		char *  colon = strchr( p, ':' );
+
+		if ( colon != NULL )
+		{
+			*colon = '\0';
+
+			if ( ! write )
+			{
+				if ( findLabel( p ) >= 0 )
+				{
+					error( path, line, "label defined twice", p );
+				}
+				else if ( nLabels >= MAX_LABELS || strlen( p ) >= sizeof(labels[0].name) )
+				{
+					error( path, line, "too many labels or label too long", p );
+				}
+				else
+				{
+					strcpy( labels[nLabels].name, p );
+					labels[nLabels++].offset = (uint16_t) nCode;
+				}
+			}
+
+			p = colon + 1;
+		}
+
+		char *  name = strtok( p, " \t\r\n" );
+
+		if ( name == NULL )
+		{
+			continue;
+		}
+
+		char *  operand;
+
+		while ( ( operand = strtok( NULL, ", \t\r\n" ) ) != NULL && nOperands < MAX_OPERANDS )
+		{
+			operands[nOperands++] = operand;
+		}
+
+		int  o;
+
+		for ( o = 0 ; o < nOps ; ++o )
+		{
+			if ( strcmp( ops[o].name, name ) == 0 && matches( ops[o], operands, nOperands ) )
+			{
+				break;
+			}
+		}
+
+		if ( o == nOps )
+		{
+			error( path, line, "unknown instruction or wrong operands", name );
+			continue;
+		}
+
+		int  size = 1;
+
+		for ( const char * kind = ops[o].operands ; *kind != '\0' ; ++kind )
+		{
+			size += ( *kind == 'c' ) ? 3 : ( *kind == 'i' || *kind == 'a' ) ? 2 : 1;
+		}
+
+		if ( nCode + size > MAX_CODE )
+		{
+			error( path, line, "program too long at", name );
+			return;
+		}
+
+		if ( ! write )
+		{
+			nCode += size;
+			continue;
+		}
+
+		code[nCode++] = ops[o].opcode;
+
+		for ( int k = 0 ; k < nOperands ; ++k )
+		{
+			long    value = 0;
+			char *  end;
+			int     l;
+
+			switch ( ops[o].operands[k] )
+			{
+				case 'r':
+					code[nCode++] = (uint8_t) registerOf( operands[k] );
+					break;
+
+				case 'n':
+					numberOf( operands[k], value );
+					if ( value < 0 || value > 255 )
+					{
+						error( path, line, "value out of range", operands[k] );
+					}
+					code[nCode++] = (uint8_t) value;
+					break;
+
+				case 'i':
+					numberOf( operands[k], value );
+					if ( value < -32768 || value > 65535 )
+					{
+						error( path, line, "value out of range", operands[k] );
+					}
+					code[nCode++] = (uint8_t) ( value & 0xFF );
+					code[nCode++] = (uint8_t) ( ( value >> 8 ) & 0xFF );
+					break;
+
+				case 'a':
+					l = findLabel( operands[k] );
+					if ( l < 0 )
+					{
+						error( path, line, "unknown label", operands[k] );
+						l = 0;
+					}
+					code[nCode++] = (uint8_t) ( labels[l].offset & 0xFF );
+					code[nCode++] = (uint8_t) ( labels[l].offset >> 8 );
+					break;
+
+				case 'c':
+					value = strtol( operands[k] + 1, &end, 16 );
+					if ( operands[k][0] != '#' || strlen( operands[k] ) != 7 || *end != '\0' )
+					{
+						error( path, line, "color must be #rrggbb, not", operands[k] );
+					}
+					code[nCode++] = (uint8_t) ( value >> 16 );
+					code[nCode++] = (uint8_t) ( value >> 8 );
+					code[nCode++] = (uint8_t) value;
+					break;
+			}
+		}
+	}
+}
+
+int main( int argc, char * argv[] )
+{
+	const char *  output = NULL;
+	const char *  array  = NULL;
+	const char *  port   = NULL;
+	int           a;
+
+	for ( a = 1 ; a + 1 < argc && argv[a][0] == '-' ; a += 2 )
+	{
+		if ( strcmp( argv[a], "-o" ) == 0 )
+		{
+			output = argv[a + 1];
+		}
+		else if ( strcmp( argv[a], "-c" ) == 0 )
+		{
+			array = argv[a + 1];
+		}
+		else if ( strcmp( argv[a], "-s" ) == 0 )
+		{
+			port = argv[a + 1];
+		}
+		else
+		{
+			break;
+		}
+	}
+
+	if ( a + 1 != argc )
+	{
+		fprintf( stderr, "usage: %s [-o file | -c name | -s port] program\n", argv[0] );
+		return 1;
+	}
+
+	FILE *  in = fopen( argv[a], "r" );
+
+	if ( in == NULL )
+	{
+		perror( argv[a] );
+		return 1;
+	}
+
+	assemble( argv[a], in, false );
+	rewind( in );
+	if ( errors == 0 )
+	{
+		assemble( argv[a], in, true );
+	}
+	fclose( in );
+
+	if ( errors > 0 )
+	{
+		return 1;
+	}
+
+	uint8_t  header[ShowProgram_HEADER_SIZE] = { ShowProgram_MAGIC, (uint8_t) ( nCode & 0xFF ), (uint8_t) ( nCode >> 8 ) };
+
+	if ( port != NULL )
+	{
+		FILE *  serial = fopen( port, "wb" );
+
+		if ( serial == NULL )
+		{
+			perror( port );
+			return 1;
+		}
+
+		fputc( 'l', serial );
+
+		for ( int i = 0 ; i < ShowProgram_HEADER_SIZE + nCode ; ++i )
+		{
+			fputc( ( i < ShowProgram_HEADER_SIZE ) ? header[i] : code[i - ShowProgram_HEADER_SIZE], serial );
+			fflush( serial );
+			usleep( SEND_GAP_US );
+		}
+
+		fclose( serial );
+		fprintf( stderr, "sent %d bytes of code, see the PROGRAM record in the event log\n", nCode );
+		return 0;
+	}
+
+	FILE *  out = ( output == NULL ) ? stdout : fopen( output, array ? "w" : "wb" );
+
+	if ( out == NULL )
+	{
+		perror( output );
+		return 1;
+	}
+
+	if ( array != NULL )
+	{
+		fprintf( out, "// Built from %s by extras/ShowAssembler.cpp.\n", argv[a] );
+		fprintf( out, "const uint8_t %s[] PROGMEM =\n\t\t\t\t{\n\t\t\t\t\t\t0x%02X, %3u, %3u,", array, header[0], header[1], header[2] );
+
+		for ( int i = 0 ; i < nCode ; ++i )
+		{
+			fprintf( out, "%s%3u%s", ( i % 12 == 0 ) ? "\n\t\t\t\t\t\t" : " ", code[i], ( i + 1 < nCode ) ? "," : "" );
+		}
+
+		fprintf( out, "\n\t\t\t\t};\n" );
+	}
+	else
+	{
+		fwrite( header, 1, ShowProgram_HEADER_SIZE, out );
+		fwrite( code, 1, nCode, out );
+	}
+
+	if ( out != stdout )
+	{
+		fclose( out );
+	}
+
+	return 0;
+}
@@ -0,0 +1,343 @@
+/**
+ * Host side replay of a mode button trace recorded by the sketch.
+ *
+ * The sketch is built with a host compiler against the stand-in Arduino
+ * core in extras/host and runs on a VirtualClock.  The replay raises the
+ * button interrupt at the times in the trace, bounces included, and runs
+ * the light shows in between, so the same field capture gives the same
+ * mode changes every time and can be run under a profiler as often as
+ * needed.  Since rendering takes no virtual time, the delay measured from
+ * an edge to the end of its mode is the time the light show spends
+ * waiting before it checks for a mode change.  The replay also reports how
+ * many times faster than real time the sketch ran.
+ *
+ * Recording and replaying a trace:
+ *
+ *     send 't' to the sketch, press the button, then send 't' again
+ *     ./LogDecoder -t capture.bin > button.trace
+ *     ./TraceReplay -o replay.bin button.trace
+ *     ./LogDecoder replay.bin
+ *
+ * Building, with FastLED built for its host (stub) platform:
+ *
+ *     g++ -O2 -Iextras/host -I$FASTLED/src -o TraceReplay \
+ *         extras/TraceReplay.cpp extras/host/Arduino.cpp *.cpp $FASTLED_OBJECTS
+ *
+ * Options:
+ *
+ *     -o capture   Write the event log of the replay to a file.
+ *     -l ms        Start the replay this long before the first edge,
+ *                  default 1000.
+ *     -e ms        Keep running this long after the last edge, default
+ *                  2000.
+ *
+ * Each line of a trace holds the millis() value of an edge, the mode
+ * before it and 1 if the sketch took it as a press or 0 if it was ignored
+ * as a bounce.  Lines starting with '#' are ignored.
+ *
+ *  @date   Created on October 18, 2026
+ *  @author Steven F. LeBrun
+ *  <br/><br/>
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include <Arduino.h>
+
+#include "../EventLog.h"
+#include "../VirtualClock.h"
+
+/**
+ * The largest number of edges that can be read from a trace.
+ */
+#define  MAX_EDGES  4096
+
+// Defined by the sketch, StripTease.cpp.
+extern volatile int   mode;
+void setup();
+void loop();
+void report_counters();
+
+/**
+ * One edge of the trace and what became of it in the replay.
+ */
+struct Edge
+{
+	unsigned long  ms;
+	int            mode;
+	int            accepted;
+
+	/**
+	 * The mode before the edge in the replay.
+	 */
+	int            replayMode;
+
+	/**
+	 * Set if the replay took the edge as a press.
+	 */
+	bool           replayed;
+
+	/**
+	 * The time in ms from the edge to the return of loop(), or -1.
+	 */
+	long           exitMs;
+};
+
+static Edge      edges[MAX_EDGES];
+static int       nEdges    = 0;
+static int       nextEdge  = 0;
+static int       firstOpen = 0;
+static uint64_t  endMicros = 0;
+
+/**
+ * Thrown from inside the sketch when the replay has run its course.
+ */
+struct ReplayEnd
+{
+};
+
+/**
+ * Raises the button interrupt at the time of each edge and ends the
+ * replay after the last one.
+ */
+class TraceClock : public VirtualClock
+{
+	protected:
+		virtual void advance( uint64_t end )
+		{
+			while ( nextEdge < nEdges && edges[nextEdge].ms * 1000ULL <= end )
+			{
+				Edge &  edge   = edges[nextEdge++];
+				int     before = mode;
+
+				VirtualClock::advance( edge.ms * 1000ULL );
+
+				if ( hostInterrupt != NULL )
+				{
+					hostInterrupt();
+				}
+
+				edge.replayMode = before;
+				edge.replayed   = ( mode != before );
+			}
+
+			if ( end >= endMicros )
+			{
+				VirtualClock::advance( endMicros );
+				throw ReplayEnd();
+			}
+
+			VirtualClock::advance( end );
+		}
+};
+
+/**
+ * Records the time loop() returned for the presses since it last did.
+ */
+static void markExits()
+{
+	for ( ; firstOpen < nextEdge ; ++firstOpen )
+	{
+		Edge &  edge = edges[firstOpen];
+
+		if ( edge.replayed )
+		{
+			edge.exitMs = (long) ( Clock::millis() - edge.ms );
+		}
+	}
+}
+
+static bool readTrace( const char * path )
+{
+	FILE * in = fopen( path, "r" );
+	char   line[128];
+
+	if ( in == NULL )
+	{
+		perror( path );
+		return false;
+	}
+
+	while ( fgets( line, sizeof(line), in ) != NULL )
+	{
+		if ( line[0] == '#' )
+		{
+			continue;
+		}
+
+		if ( nEdges >= MAX_EDGES )
+		{
+			fprintf( stderr, "%s: only the first %d edges are replayed\n", path, MAX_EDGES );
+			break;
+		}
+
+		Edge &  edge = edges[nEdges];
+
+		if ( sscanf( line, "%lu %d %d", &edge.ms, &edge.mode, &edge.accepted ) == 3 )
+		{
+			edge.replayed = false;
+			edge.exitMs   = -1;
+
+			if ( nEdges > 0 && edge.ms < edges[nEdges - 1].ms )
+			{
+				fprintf( stderr, "%s: edges must be in time order\n", path );
+				fclose( in );
+				return false;
+			}
+
+			++nEdges;
+		}
+	}
+
+	fclose( in );
+	return true;
+}
+
+int main( int argc, char * argv[] )
+{
+	const char *   output = NULL;
+	unsigned long  lead   = 1000;
+	unsigned long  tail   = 2000;
+	TraceClock     clock;
+	clock_t        started;
+	int            a;
+	int            i;
+
+	for ( a = 1 ; a < argc && argv[a][0] == '-' ; ++a )
+	{
+		if ( strcmp( argv[a], "-o" ) == 0 && a + 1 < argc )
+		{
+			output = argv[++a];
+		}
+		else if ( strcmp( argv[a], "-l" ) == 0 && a + 1 < argc )
+		{
+			lead = strtoul( argv[++a], NULL, 10 );
+		}
+		else if ( strcmp( argv[a], "-e" ) == 0 && a + 1 < argc )
+		{
+			tail = strtoul( argv[++a], NULL, 10 );
+		}
+		else
+		{
+			break;
+		}
+	}
+
+	if ( a + 1 != argc )
+	{
+		fprintf( stderr, "usage: %s [-o capture] [-l lead_ms] [-e tail_ms] trace\n", argv[0] );
+		return 1;
+	}
+
+	if ( ! readTrace( argv[a] ) )
+	{
+		return 1;
+	}
+
+	if ( nEdges == 0 )
+	{
+		fprintf( stderr, "%s: no edges\n", argv[a] );
+		return 1;
+	}
+
+	if ( output != NULL )
+	{
+		Serial.out = fopen( output, "wb" );
+		if ( Serial.out == NULL )
+		{
+			perror( output );
+			return 1;
+		}
+	}
+
+	// Start in the mode the first edge found, a little before it.
+	clock.set( ( edges[0].ms > lead ) ? ( edges[0].ms - lead ) * 1000ULL : 0 );
+	endMicros = ( edges[nEdges - 1].ms + tail ) * 1000ULL;
+	mode      = edges[0].mode;
+	started   = ::clock();
+
+	uint64_t  first = clock.read();
+
+	Clock::use( &clock );
+	setup();
+
+	try
+	{
+		for ( ; ; )
+		{
+			loop();
+			markExits();
+		}
+	}
+	catch ( ReplayEnd & )
+	{
+	}
+
+	double  hostMs    = 1000.0 * ( ::clock() - started ) / CLOCKS_PER_SEC;
+	double  virtualMs = ( clock.read() - first ) / 1000.0;
+
+	report_counters();
+	EventLog::flush();
+	Clock::use( NULL );
+
+	if ( Serial.out != NULL )
+	{
+		fclose( Serial.out );
+	}
+
+	int   presses    = 0;
+	int   mismatches = 0;
+	long  total      = 0;
+	long  worst      = 0;
+
+	printf( "%10s  %4s  %8s  %8s  %7s\n", "ms", "mode", "recorded", "replayed", "exit_ms" );
+
+	for ( i = 0 ; i < nEdges ; ++i )
+	{
+		Edge &  edge = edges[i];
+
+		printf( "%10lu  %4d  %8s  %8s", edge.ms, edge.mode,
+		        edge.accepted ? "press" : "bounce", edge.replayed ? "press" : "bounce" );
+
+		if ( edge.exitMs >= 0 )
+		{
+			printf( "  %7ld", edge.exitMs );
+			++presses;
+			total += edge.exitMs;
+			if ( edge.exitMs > worst )
+			{
+				worst = edge.exitMs;
+			}
+		}
+
+		if ( ( edge.accepted != 0 ) != edge.replayed || edge.mode != edge.replayMode )
+		{
+			printf( "  differs from the recording" );
+			++mismatches;
+		}
+
+		printf( "\n" );
+	}
+
+	printf( "%d edges, %d presses, %d differ from the recording", nEdges, presses, mismatches );
+
+	if ( presses > 0 )
+	{
+		printf( ", exit_ms avg %ld max %ld", total / presses, worst );
+	}
+
+	printf( "\n" );
+	printf( "%.0f ms of sketch time in %.1f ms", virtualMs, hostMs );
+
+	if ( hostMs > 0 )
+	{
+		printf( ", %.0f times real time", virtualMs / hostMs );
+	}
+
+	printf( "\n" );
+
+	return 0;
+}
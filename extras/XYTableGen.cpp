@@ -0,0 +1,80 @@
+/**
+ * Host side generator for the index tables used by the XYMap class.
+ *
+ * Prints a PROGMEM table that maps each cell of a matrix, row by row, to
+ * the offset of its LED unit along the data line.  The output is pasted
+ * into XYMap.cpp, for example:
+ *
+ *     g++ -O2 -o XYTableGen extras/XYTableGen.cpp
+ *     ./XYTableGen 16 16 serpentine SERPENTINE_16x16
+ *
+ * Layouts:
+ *
+ *     progressive   Every row runs left to right.
+ *     serpentine    Even rows run left to right, odd rows right to left.
+ *
+ * Matrices wired in other ways can be given a table by editing the output
+ * by hand.  The table must cover every cell.
+ *
+ *  @date   Created on October 18, 2026
+ *  @author Steven F. LeBrun
+ *  <br/><br/>
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+/**
+ * The number of table entries printed on each line.
+ */
+#define  PER_LINE  16
+
+int main( int argc, char * argv[] )
+{
+	if ( argc != 5 )
+	{
+		fprintf( stderr, "usage: %s width height progressive|serpentine NAME\n", argv[0] );
+		return 1;
+	}
+
+	int     width      = atoi( argv[1] );
+	int     height     = atoi( argv[2] );
+	bool    serpentine = ( strcmp( argv[3], "serpentine" ) == 0 );
+	int     x;
+	int     y;
+
+	if ( width < 1 || width > 255 || height < 1 || height > 255 )
+	{
+		fprintf( stderr, "width and height must be 1 to 255\n" );
+		return 1;
+	}
+
+	printf( "const uint16_t XYMap::%s[] PROGMEM =\n{\n", argv[4] );
+
+	for ( y = 0 ; y < height ; ++y )
+	{
+		for ( x = 0 ; x < width ; ++x )
+		{
+			int  cell  = y * width + x;
+			int  index = ( serpentine && ( y & 1 ) ) ? y * width + ( width - 1 - x ) : cell;
+
+			if ( cell % PER_LINE == 0 )
+			{
+				printf( "\t" );
+			}
+
+			printf( "%4d%s", index, ( cell + 1 < width * height ) ? "," : "" );
+			printf( ( cell % PER_LINE == PER_LINE - 1 ) ? "\n" : " " );
+		}
+	}
+
+	if ( ( width * height ) % PER_LINE != 0 )
+	{
+		printf( "\n" );
+	}
+
+	printf( "};\n" );
+
+	return 0;
+}
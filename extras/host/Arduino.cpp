@@ -0,0 +1,114 @@
+/*
+ * Arduino.cpp
+ *
+ *  Created on: Oct 18, 2026
+ *      Author: Steven F. LeBrun
+ */
+
+#include <time.h>
+
+#include "Arduino.h"
+#include "EEPROM.h"
+
+uint8_t      SREG          = 0;
+HostSerial   Serial;
+HostEEPROM   EEPROM;
+void      (* hostInterrupt)() = NULL;
+
+static unsigned long  seed = 1;
+
+/**
+ * @return Returns the time of the host in microseconds since it was first
+ *         read, which may be while static objects are being constructed.
+ */
+static uint64_t hostTime()
+{
+	static uint64_t  started = 0;
+	struct timespec  ts;
+
+	clock_gettime( CLOCK_MONOTONIC, &ts );
+
+	uint64_t  now = (uint64_t) ts.tv_sec * 1000000ULL + ts.tv_nsec / 1000;
+
+	if ( started == 0 )
+	{
+		started = now;
+	}
+
+	return now - started;
+}
+
+unsigned long millis()
+{
+	return (unsigned long) ( hostTime() / 1000 );
+}
+
+unsigned long micros()
+{
+	return (unsigned long) hostTime();
+}
+
+void delay( unsigned long ms )
+{
+	struct timespec  ts = { (time_t) ( ms / 1000 ), (long) ( ms % 1000 ) * 1000000L };
+
+	nanosleep( &ts, NULL );
+	yield();
+}
+
+void delayMicroseconds( unsigned int us )
+{
+	struct timespec  ts = { (time_t) ( us / 1000000 ), (long) ( us % 1000000 ) * 1000L };
+
+	nanosleep( &ts, NULL );
+}
+
+void pinMode( uint8_t, uint8_t )
+{
+}
+
+void digitalWrite( uint8_t, uint8_t )
+{
+}
+
+int digitalRead( uint8_t )
+{
+	return LOW;
+}
+
+int analogRead( uint8_t )
+{
+	return 0;
+}
+
+long random( long howBig )
+{
+	if ( howBig <= 0 )
+	{
+		return 0;
+	}
+
+	seed = seed * 1103515245UL + 12345UL;
+
+	return (long) ( ( seed >> 16 ) & 0x7FFF ) % howBig;
+}
+
+long random( long howSmall, long howBig )
+{
+	if ( howSmall >= howBig )
+	{
+		return howSmall;
+	}
+
+	return howSmall + random( howBig - howSmall );
+}
+
+void randomSeed( unsigned long value )
+{
+	seed = value + 1;
+}
+
+void attachInterrupt( uint8_t, void (*handler)(), int )
+{
+	hostInterrupt = handler;
+}
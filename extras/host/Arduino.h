@@ -0,0 +1,132 @@
+/**
+ * A stand-in for the Arduino core, used to build the sketch with a host
+ * compiler for extras/TraceReplay.cpp.
+ *
+ * millis(), micros() and delay() use the real time of the host, so the
+ * HardwareClock and the benchmarks work as they do on a board.  The sketch
+ * reads the time through the Clock class, and a replay installs a
+ * VirtualClock, which raises the button interrupt at the recorded times.
+ *
+ * Only the parts of the Arduino core that the sketch uses are provided.
+ * FastLED is built with its host (stub) platform, which sends nothing.
+ *
+ *  @date   Created on October 18, 2026
+ *  @author Steven F. LeBrun
+ *  <br/><br/>
+ */
+
+#ifndef HOST_ARDUINO_H_
+#define HOST_ARDUINO_H_
+
+#include <math.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+typedef uint8_t   byte;
+typedef uint16_t  word;
+
+#define  LOW      0
+#define  HIGH     1
+
+#define  INPUT    0
+#define  OUTPUT   1
+
+#define  RISING   3
+#define  INT0     0
+
+#define  A0       14
+#define  A1       15
+#define  A2       16
+#define  A3       17
+#define  A4       18
+#define  A5       19
+
+#define  F_CPU    16000000L
+
+#define  PROGMEM
+#define  pgm_read_byte(p)   ( *(const uint8_t *) (p) )
+#define  pgm_read_word(p)   ( *(const uint16_t *) (p) )
+#define  pgm_read_dword(p)  ( *(const uint32_t *) (p) )
+#define  pgm_read_ptr(p)    ( *(void * const *) (p) )
+#define  memcpy_P           memcpy
+#define  F(s)               (s)
+
+#define  _BV(bit)           ( 1 << (bit) )
+#define  lowByte(w)         ( (uint8_t) ( (w) & 0xFF ) )
+#define  highByte(w)        ( (uint8_t) ( (w) >> 8 ) )
+
+template <class T> T min( T a, T b ) { return ( a < b ) ? a : b; }
+template <class T> T max( T a, T b ) { return ( a > b ) ? a : b; }
+
+/**
+ * Saved and restored around critical sections.  There is nothing to mask
+ * on a host, since the interrupt is only raised while the clock waits.
+ */
+extern uint8_t  SREG;
+
+inline void noInterrupts() {}
+inline void interrupts() {}
+
+unsigned long millis();
+unsigned long micros();
+
+/**
+ * Sleeps, and then calls yield() as the Arduino core does.
+ */
+void delay( unsigned long ms );
+void delayMicroseconds( unsigned int us );
+
+/**
+ * Defined by the sketch.
+ */
+void yield();
+
+void pinMode( uint8_t pin, uint8_t mode );
+void digitalWrite( uint8_t pin, uint8_t value );
+int  digitalRead( uint8_t pin );
+int  analogRead( uint8_t pin );
+
+/**
+ * A fixed pseudo random sequence, so that every replay of a trace makes
+ * the same sparkles.
+ */
+long random( long howBig );
+long random( long howSmall, long howBig );
+void randomSeed( unsigned long seed );
+
+void attachInterrupt( uint8_t interrupt, void (*handler)(), int mode );
+
+/**
+ * The serial port.  What the sketch writes goes to a file, so the event
+ * log of a replay can be read by extras/LogDecoder.cpp, and nothing is
+ * ever received.
+ */
+class HostSerial
+{
+	public:
+		/**
+		 * Where the written bytes go, or NULL to throw them away.
+		 */
+		FILE *  out;
+
+		HostSerial() : out(NULL) {};
+
+		void   begin( long ) {};
+		int    available() { return 0; };
+		int    read() { return -1; };
+		int    availableForWrite() { return 64; };
+		size_t write( uint8_t b ) { if ( out != NULL ) { fputc( b, out ); } return 1; };
+		size_t print( const char * s ) { if ( out != NULL ) { fputs( s, out ); } return strlen( s ); };
+};
+
+extern HostSerial  Serial;
+
+/**
+ * The handler given to attachInterrupt(), or NULL.
+ */
+extern void      (* hostInterrupt)();
+
+#endif /* HOST_ARDUINO_H_ */
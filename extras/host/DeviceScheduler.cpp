@@ -0,0 +1,303 @@
+/*
+ * DeviceScheduler.cpp
+ *
+ *  Created on: Oct 18, 2026
+ *      Author: Steven F. LeBrun
+ */
+
+#include <algorithm>
+#include <chrono>
+#include <functional>
+#include <queue>
+
+#ifdef __linux__
+#include <pthread.h>
+#include <sched.h>
+#endif
+
+#include "DeviceScheduler.h"
+
+/**
+ * The longest the scheduler sleeps before it looks for frames that are
+ * due, in microseconds.
+ */
+#define  DeviceScheduler_POLL_US  50
+
+/**
+ * How long an idle thread sleeps before it looks for frames again, in
+ * microseconds.
+ */
+#define  DeviceScheduler_IDLE_US  20
+
+DeviceScheduler::DeviceScheduler() :
+	stopping(false), elapsed(0)
+{
+}
+
+DeviceScheduler::~DeviceScheduler()
+{
+	clearWorkers();
+}
+
+uint64_t DeviceScheduler::now()
+{
+	return std::chrono::duration_cast<std::chrono::microseconds>(
+	           std::chrono::steady_clock::now().time_since_epoch() ).count();
+}
+
+void DeviceScheduler::add( LightShow * show )
+{
+	Entry  entry = { show, 0, 0 };
+
+	entries.push_back( entry );
+}
+
+void DeviceScheduler::clearWorkers()
+{
+	stopping = true;
+
+	for ( size_t w = 0 ; w < workers.size() ; ++w )
+	{
+		if ( workers[w]->thread.joinable() )
+		{
+			workers[w]->thread.join();
+		}
+
+		delete workers[w];
+	}
+
+	workers.clear();
+}
+
+bool DeviceScheduler::take( int index, int & task )
+{
+	int  nWorkers = (int) workers.size();
+
+	{
+		Worker &                     own = *workers[index];
+		std::lock_guard<std::mutex>  guard( own.lock );
+
+		if ( ! own.tasks.empty() )
+		{
+			task = own.tasks.back();
+			own.tasks.pop_back();
+			return true;
+		}
+	}
+
+	for ( int n = 1 ; n < nWorkers ; ++n )
+	{
+		Worker &                     other = *workers[( index + n ) % nWorkers];
+		std::lock_guard<std::mutex>  guard( other.lock );
+
+		if ( ! other.tasks.empty() )
+		{
+			task = other.tasks.front();
+			other.tasks.pop_front();
+			++workers[index]->stolen;
+			return true;
+		}
+	}
+
+	return false;
+}
+
+void DeviceScheduler::work( int index )
+{
+	Worker &  worker = *workers[index];
+	int       task;
+
+	while ( ! stopping.load() )
+	{
+		if ( ! take( index, task ) )
+		{
+			std::this_thread::sleep_for( std::chrono::microseconds( DeviceScheduler_IDLE_US ) );
+			continue;
+		}
+
+		Entry &   entry   = entries[task];
+		uint64_t  started = now();
+
+		entry.show->nextFrame();
+		entry.show->getLedDevice()->commit();
+
+		uint64_t  finished = now();
+		uint64_t  latency  = finished - entry.due;
+
+		worker.busy += finished - started;
+		++worker.frames;
+		worker.latencies.push_back( (uint32_t) std::min( latency, (uint64_t) UINT32_MAX ) );
+
+		// A late frame starts the next one as soon as it can rather than
+		// trying to catch up, as LightShow::display() does.
+		if ( entry.period > 0 && latency > entry.period )
+		{
+			++worker.missed;
+		}
+
+		entry.due += entry.period;
+		if ( entry.due < finished )
+		{
+			entry.due = finished;
+		}
+
+		std::lock_guard<std::mutex>  guard( returnLock );
+		returned.push_back( task );
+	}
+}
+
+void DeviceScheduler::run( int nThreads, double seconds )
+{
+	typedef std::pair<uint64_t, int>  Due;
+
+	std::priority_queue< Due, std::vector<Due>, std::greater<Due> >  pending;
+
+	int       nEntries = (int) entries.size();
+	int       next     = 0;
+	uint64_t  started  = now();
+	uint64_t  end      = started + (uint64_t) ( seconds * 1e6 );
+
+	clearWorkers();
+	returned.clear();
+	sorted.clear();
+	stopping = false;
+
+	for ( int e = 0 ; e < nEntries ; ++e )
+	{
+		Entry &  entry = entries[e];
+
+		entry.show->start();
+		entry.period = 1000ULL * entry.show->framePeriod( entry.show->getQuality() );
+		entry.due    = started + entry.period * e / nEntries;
+		pending.push( Due( entry.due, e ) );
+	}
+
+	for ( int w = 0 ; w < nThreads ; ++w )
+	{
+		Worker *  worker = new Worker();
+
+		worker->busy   = 0;
+		worker->frames = 0;
+		worker->stolen = 0;
+		worker->missed = 0;
+		workers.push_back( worker );
+	}
+
+	for ( int w = 0 ; w < nThreads ; ++w )
+	{
+		workers[w]->thread = std::thread( &DeviceScheduler::work, this, w );
+
+#ifdef __linux__
+		if ( nThreads <= (int) std::thread::hardware_concurrency() )
+		{
+			cpu_set_t  cores;
+
+			CPU_ZERO( &cores );
+			CPU_SET( w, &cores );
+			pthread_setaffinity_np( workers[w]->thread.native_handle(), sizeof(cores), &cores );
+		}
+#endif
+	}
+
+	for ( ; ; )
+	{
+		uint64_t  time = now();
+
+		if ( time >= end )
+		{
+			break;
+		}
+
+		{
+			std::lock_guard<std::mutex>  guard( returnLock );
+
+			for ( size_t r = 0 ; r < returned.size() ; ++r )
+			{
+				pending.push( Due( entries[returned[r]].due, returned[r] ) );
+			}
+
+			returned.clear();
+		}
+
+		while ( ! pending.empty() && pending.top().first <= time )
+		{
+			Worker &                     worker = *workers[next];
+			std::lock_guard<std::mutex>  guard( worker.lock );
+
+			worker.tasks.push_back( pending.top().second );
+			pending.pop();
+			next = ( next + 1 ) % nThreads;
+		}
+
+		uint64_t  wait = DeviceScheduler_POLL_US;
+
+		if ( ! pending.empty() && pending.top().first - time < wait )
+		{
+			wait = pending.top().first - time;
+		}
+
+		std::this_thread::sleep_for( std::chrono::microseconds( wait ) );
+	}
+
+	stopping = true;
+
+	for ( int w = 0 ; w < nThreads ; ++w )
+	{
+		workers[w]->thread.join();
+		sorted.insert( sorted.end(), workers[w]->latencies.begin(), workers[w]->latencies.end() );
+	}
+
+	elapsed = now() - started;
+	std::sort( sorted.begin(), sorted.end() );
+}
+
+unsigned long DeviceScheduler::getFrames()
+{
+	return (unsigned long) sorted.size();
+}
+
+unsigned long DeviceScheduler::getMissed()
+{
+	unsigned long  total = 0;
+
+	for ( size_t w = 0 ; w < workers.size() ; ++w )
+	{
+		total += workers[w]->missed;
+	}
+
+	return total;
+}
+
+unsigned long DeviceScheduler::getStolen()
+{
+	unsigned long  total = 0;
+
+	for ( size_t w = 0 ; w < workers.size() ; ++w )
+	{
+		total += workers[w]->stolen;
+	}
+
+	return total;
+}
+
+uint32_t DeviceScheduler::getLatency( double fraction )
+{
+	if ( sorted.empty() )
+	{
+		return 0;
+	}
+
+	size_t  n = (size_t) ( fraction * sorted.size() );
+
+	return sorted[( n < sorted.size() ) ? n : sorted.size() - 1];
+}
+
+double DeviceScheduler::getUtilization( int index )
+{
+	if ( index < 0 || index >= (int) workers.size() || elapsed == 0 )
+	{
+		return 0;
+	}
+
+	return (double) workers[index]->busy / elapsed;
+}
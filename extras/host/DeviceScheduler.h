@@ -0,0 +1,206 @@
+/**
+ * Runs the frames of many light shows, each on a device of its own, on a
+ * pool of threads, for extras/DeviceFarm.cpp.
+ *
+ *  @date   Created on October 18, 2026
+ *  @author Steven F. LeBrun
+ *  <br/><br/>
+ */
+
+#ifndef DEVICESCHEDULER_H_
+#define DEVICESCHEDULER_H_
+
+#include <stdint.h>
+
+#include <atomic>
+#include <deque>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "../../LightShow.h"
+
+/**
+ * Runs the frames of many light shows on a work-stealing pool of threads.
+ *
+ * Each light show is given a frame each period of its frame governor,
+ * @see LightShow::framePeriod(), the way LightShow::display() would, but
+ * no light show has a loop of its own.  A frame is due at the start of its
+ * period and has until the next one is due to be out: when it is due the
+ * light show is queued on the next thread in turn, and a thread that runs
+ * out of frames of its own steals the oldest frame queued on another.  A
+ * frame runs LightShow::nextFrame() and then commits the device, so the
+ * device must send its frame from show(), @see SinkDevice.
+ *
+ * The light shows must not share state that is not safe between threads,
+ * such as the event log or the random numbers.
+ *
+ * The results of a run are kept until the next.
+ */
+class DeviceScheduler
+{
+	private:
+		/**
+		 * A light show and when its next frame is due, in us of the
+		 * scheduler's clock.
+		 */
+		struct Entry
+		{
+			LightShow *  show;
+			uint64_t     due;
+			uint64_t     period;
+		};
+
+		/**
+		 * A thread of the pool, its queue of entries and its results.
+		 */
+		struct Worker
+		{
+			std::deque<int>        tasks;
+			std::mutex             lock;
+			std::thread            thread;
+			uint64_t               busy;
+			unsigned long          frames;
+			unsigned long          stolen;
+			unsigned long          missed;
+			std::vector<uint32_t>  latencies;
+		};
+
+		/**
+		 * The light shows, in the order added.
+		 */
+		std::vector<Entry>     entries;
+
+		/**
+		 * The threads of the current or last run.
+		 */
+		std::vector<Worker *>  workers;
+
+		/**
+		 * The entries whose frames are done, waiting to be queued again.
+		 */
+		std::vector<int>       returned;
+		std::mutex             returnLock;
+
+		/**
+		 * Set to stop the threads at the end of a run.
+		 */
+		std::atomic<bool>      stopping;
+
+		/**
+		 * The latencies of the last run from all threads, in order.
+		 */
+		std::vector<uint32_t>  sorted;
+
+		/**
+		 * The length of the last run in us.
+		 */
+		uint64_t               elapsed;
+
+		/**
+		 * @return Returns the time in us since an arbitrary start.
+		 */
+		static uint64_t now();
+
+		/**
+		 * Takes the newest entry queued on a thread, or steals the oldest
+		 * one queued on another.
+		 *
+		 * @param index  The thread.
+		 * @param task   Set to the entry taken.
+		 * @return Returns true if an entry was taken.
+		 */
+		bool take( int index, int & task );
+
+		/**
+		 * The body of a thread of the pool.
+		 *
+		 * @param index  The thread.
+		 */
+		void work( int index );
+
+		/**
+		 * Joins and deletes the threads of the last run.
+		 */
+		void clearWorkers();
+
+	public:
+		/**
+		 * Constructor.
+		 */
+		DeviceScheduler();
+
+		/**
+		 * Destructor.  The light shows are not deleted.
+		 */
+		virtual ~DeviceScheduler();
+
+		/**
+		 * Adds a light show.  Its device must not be used by another.
+		 *
+		 * @param show  The light show.
+		 */
+		void add( LightShow * show );
+
+		/**
+		 * Starts every light show and runs their frames for a time.  The
+		 * first frames are spread over one period so that they are not
+		 * all due at once, as a controller would phase its outputs.
+		 *
+		 * On Linux thread n is held to core n when there are no more
+		 * threads than cores.
+		 *
+		 * @param nThreads  The number of threads in the pool.
+		 * @param seconds   How long to run.
+		 */
+		void run( int nThreads, double seconds );
+
+		/**
+		 * @return Returns the number of light shows.
+		 */
+		int numberOfShows() { return (int) entries.size(); };
+
+		/**
+		 * @return Returns the number of threads of the last run.
+		 */
+		int numberOfThreads() { return (int) workers.size(); };
+
+		/**
+		 * @return Returns the length of the last run in seconds.
+		 */
+		double getSeconds() { return elapsed / 1e6; };
+
+		/**
+		 * @return Returns the number of frames in the last run.
+		 */
+		unsigned long getFrames();
+
+		/**
+		 * @return Returns the number of frames that were out after the
+		 *         next one was due.
+		 */
+		unsigned long getMissed();
+
+		/**
+		 * @return Returns the number of frames run by a thread other than
+		 *         the one they were queued on.
+		 */
+		unsigned long getStolen();
+
+		/**
+		 * @param fraction  The fraction of frames, 0.5 for the median.
+		 * @return Returns the latency in us, from the time a frame was due
+		 *         to the time it was out, that this fraction of the frames
+		 *         met.
+		 */
+		uint32_t getLatency( double fraction );
+
+		/**
+		 * @param index  The thread.
+		 * @return Returns the fraction of the last run the thread spent
+		 *         running frames.
+		 */
+		double getUtilization( int index );
+};
+
+#endif /* DEVICESCHEDULER_H_ */
@@ -0,0 +1,42 @@
+/**
+ * A stand-in for the EEPROM library of the Arduino core, for the host
+ * builds of extras/host.  The EEPROM of an Arduino Uno is held in memory
+ * and starts erased, so nothing is kept from one run to the next.
+ *
+ *  @date   Created on October 18, 2026
+ *  @author Steven F. LeBrun
+ *  <br/><br/>
+ */
+
+#ifndef HOST_EEPROM_H_
+#define HOST_EEPROM_H_
+
+#include <stdint.h>
+
+/**
+ * The number of bytes of EEPROM.
+ */
+#define  HostEEPROM_SIZE  1024
+
+/**
+ * The EEPROM, as the sketch sees it.
+ */
+class HostEEPROM
+{
+	public:
+		/**
+		 * The bytes of EEPROM.
+		 */
+		uint8_t  bytes[HostEEPROM_SIZE];
+
+		HostEEPROM() { for ( int i = 0 ; i < HostEEPROM_SIZE ; ++i ) { bytes[i] = 0xFF; } };
+
+		uint8_t  read( int address ) { return bytes[address % HostEEPROM_SIZE]; };
+		void     write( int address, uint8_t value ) { bytes[address % HostEEPROM_SIZE] = value; };
+		void     update( int address, uint8_t value ) { write( address, value ); };
+		uint16_t length() { return HostEEPROM_SIZE; };
+};
+
+extern HostEEPROM  EEPROM;
+
+#endif /* HOST_EEPROM_H_ */
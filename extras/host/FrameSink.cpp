@@ -0,0 +1,67 @@
+/*
+ * FrameSink.cpp
+ *
+ *  Created on: Oct 18, 2026
+ *      Author: Steven F. LeBrun
+ */
+
+#include "FrameSink.h"
+#include "../../LedDevice.h"
+
+FileSink::FileSink( FILE * out ) :
+	out(out)
+{
+}
+
+void FileSink::write( const CRGB * frame, int n )
+{
+	if ( out == NULL )
+	{
+		return;
+	}
+
+	for ( int i = 0 ; i < n ; ++i )
+	{
+		fputc( frame[i].r, out );
+		fputc( frame[i].g, out );
+		fputc( frame[i].b, out );
+	}
+
+	fflush( out );
+}
+
+WireSink::WireSink( FrameSink * next ) :
+	next(next)
+{
+}
+
+void WireSink::write( const CRGB * frame, int n )
+{
+	// The real sleep of the host, not the Clock of the light shows.
+	delayMicroseconds( n * LedDevice_WIRE_US_PER_LED + LedDevice_WIRE_US_LATCH );
+
+	if ( next != NULL )
+	{
+		next->write( frame, n );
+	}
+}
+
+ChecksumSink::ChecksumSink() :
+	checksum(0), frames(0), wireMicros(0)
+{
+}
+
+void ChecksumSink::write( const CRGB * frame, int n )
+{
+	const uint8_t *  bytes = (const uint8_t *) frame;
+	uint32_t         sum   = checksum;
+
+	for ( int i = 0 ; i < n * 3 ; ++i )
+	{
+		sum = ( sum << 5 ) + sum + bytes[i];
+	}
+
+	checksum    = sum;
+	wireMicros += (uint64_t) n * LedDevice_WIRE_US_PER_LED + LedDevice_WIRE_US_LATCH;
+	++frames;
+}
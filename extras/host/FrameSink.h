@@ -0,0 +1,136 @@
+/**
+ * Destinations for the frames sent by a ThreadedDevice or a SinkDevice.
+ *
+ *  @date   Created on October 18, 2026
+ *  @author Steven F. LeBrun
+ *  <br/><br/>
+ */
+
+#ifndef FRAMESINK_H_
+#define FRAMESINK_H_
+
+#include <stdint.h>
+#include <stdio.h>
+
+#include <FastLED.h>
+
+/**
+ * Where the output thread of a ThreadedDevice, or the show() of a
+ * SinkDevice, sends each frame.
+ */
+class FrameSink
+{
+	public:
+		/**
+		 * Destructor.
+		 */
+		virtual ~FrameSink() {};
+
+		/**
+		 * Sends one frame.  Called on the output thread only.
+		 *
+		 * @param frame  The colors of the LED units.
+		 * @param n      The number of LED units.
+		 */
+		virtual void write( const CRGB * frame, int n ) = 0;
+};
+
+/**
+ * Writes each frame to a file, a named pipe or standard output as raw
+ * red, green and blue bytes, three per LED unit.
+ */
+class FileSink: public FrameSink
+{
+	private:
+		/**
+		 * The open file, or NULL to throw the frames away.  Not closed by
+		 * this object.
+		 */
+		FILE *  out;
+
+	public:
+		/**
+		 * Constructor.
+		 *
+		 * @param out  The open file, or NULL.
+		 */
+		FileSink( FILE * out );
+
+		virtual void write( const CRGB * frame, int n );
+};
+
+/**
+ * Stands in for a WS2812 data line: takes as long as the frame would take
+ * on the wire, @see LedDevice::wireTime(), and then
+ * passes the frame on to another sink if there is one.
+ */
+class WireSink: public FrameSink
+{
+	private:
+		/**
+		 * The sink the frame is passed on to, or NULL.
+		 */
+		FrameSink *  next;
+
+	public:
+		/**
+		 * Constructor.
+		 *
+		 * @param next  The sink the frame is passed on to, or NULL.
+		 */
+		WireSink( FrameSink * next = NULL );
+
+		virtual void write( const CRGB * frame, int n );
+};
+
+/**
+ * Stands in for the output of one of many devices: reads every byte of
+ * the frame into a checksum, as a driver copying it out would, and adds
+ * up the time the frame would take on the wire without waiting for it.
+ * Used by the scheduler, @see DeviceScheduler, where sleeping for each
+ * frame would tie up the threads doing the rendering.
+ */
+class ChecksumSink: public FrameSink
+{
+	private:
+		/**
+		 * The checksum of all frames written.
+		 */
+		uint32_t       checksum;
+
+		/**
+		 * The number of frames written.
+		 */
+		unsigned long  frames;
+
+		/**
+		 * The time the frames would have taken on the wire, in us.
+		 */
+		uint64_t       wireMicros;
+
+	public:
+		/**
+		 * Constructor.
+		 */
+		ChecksumSink();
+
+		virtual void write( const CRGB * frame, int n );
+
+		/**
+		 * @return Returns the checksum of all frames written.
+		 */
+		uint32_t getChecksum() { return checksum; };
+
+		/**
+		 * @return Returns the number of frames written.
+		 */
+		unsigned long getFrames() { return frames; };
+
+		/**
+		 * @return Returns the time the frames would have taken on the wire,
+		 *         in microseconds.
+		 */
+		uint64_t getWireMicros() { return wireMicros; };
+};
+
+#endif /* FRAMESINK_H_ */
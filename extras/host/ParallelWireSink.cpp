@@ -0,0 +1,111 @@
+/*
+ * ParallelWireSink.cpp
+ *
+ *  Created on: Oct 18, 2026
+ *      Author: Steven F. LeBrun
+ */
+
+#include "../../LedDevice.h"
+#include "ParallelWireSink.h"
+
+ParallelWireSink::ParallelWireSink( int segments, bool parallel, FrameSink * next ) :
+	segments(( segments > 0 ) ? segments : 1), next(next), nLEDs(0), frame(0), busy(0), stopping(false)
+{
+	if ( parallel && this->segments > 1 )
+	{
+		for ( int s = 0 ; s < this->segments ; ++s )
+		{
+			lines.push_back( std::thread( &ParallelWireSink::run, this, s ) );
+		}
+	}
+}
+
+ParallelWireSink::~ParallelWireSink()
+{
+	{
+		std::lock_guard<std::mutex>  guard( lock );
+
+		stopping = true;
+	}
+	ready.notify_all();
+
+	for ( size_t s = 0 ; s < lines.size() ; ++s )
+	{
+		lines[s].join();
+	}
+}
+
+void ParallelWireSink::send( int segment, int n )
+{
+	int  size  = ( n + segments - 1 ) / segments;
+	int  first = segment * size;
+	int  count = ( first + size <= n ) ? size : n - first;
+
+	if ( count > 0 )
+	{
+		// The real sleep of the host, not the Clock of the light shows.
+		delayMicroseconds( count * LedDevice_WIRE_US_PER_LED + LedDevice_WIRE_US_LATCH );
+	}
+}
+
+void ParallelWireSink::run( int segment )
+{
+	unsigned long  sent = 0;
+
+	for ( ; ; )
+	{
+		int  n;
+
+		{
+			std::unique_lock<std::mutex>  guard( lock );
+
+			ready.wait( guard, [&]() { return stopping || frame != sent; } );
+
+			if ( stopping )
+			{
+				return;
+			}
+
+			sent = frame;
+			n    = nLEDs;
+		}
+
+		send( segment, n );
+
+		{
+			std::lock_guard<std::mutex>  guard( lock );
+
+			if ( --busy == 0 )
+			{
+				finished.notify_one();
+			}
+		}
+	}
+}
+
+void ParallelWireSink::write( const CRGB * colors, int n )
+{
+	if ( lines.empty() )
+	{
+		for ( int s = 0 ; s < segments ; ++s )
+		{
+			send( s, n );
+		}
+	}
+	else
+	{
+		std::unique_lock<std::mutex>  guard( lock );
+
+		nLEDs = n;
+		busy  = segments;
+		++frame;
+		ready.notify_all();
+
+		finished.wait( guard, [&]() { return busy == 0; } );
+	}
+
+	if ( next != NULL )
+	{
+		next->write( colors, n );
+	}
+}
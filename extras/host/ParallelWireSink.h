@@ -0,0 +1,122 @@
+/**
+ * A FrameSink that stands in for a strip split across several WS2812 data
+ * lines, for the parallel output check, @see extras/ParallelWire.cpp.
+ *
+ *  @date   Created on October 18, 2026
+ *  @author Steven F. LeBrun
+ *  <br/><br/>
+ */
+
+#ifndef PARALLELWIRESINK_H_
+#define PARALLELWIRESINK_H_
+
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "FrameSink.h"
+
+/**
+ * Stands in for a strip split into segments, each on a data line of its
+ * own, @see LedParallelStrip.  The LED units are divided evenly between
+ * the lines, in order, as LedParallelStrip does.
+ *
+ * Each line takes as long as its segment would take on the wire.  When
+ * the lines are parallel, as with the FastLED drivers of a Teensy 4 or an
+ * ESP32, each line has a thread of its own and write() returns once the
+ * last of them has finished, so the time measured includes waking and
+ * waiting for the threads.  Otherwise the segments are sent one after the
+ * other on the calling thread, as on AVR.
+ *
+ * The frame is then passed on to another sink if there is one.
+ */
+class ParallelWireSink: public FrameSink
+{
+	private:
+		/**
+		 * The number of data lines.
+		 */
+		int                       segments;
+
+		/**
+		 * The sink the frame is passed on to, or NULL.
+		 */
+		FrameSink *               next;
+
+		/**
+		 * One thread for each data line when they are parallel, otherwise
+		 * empty.
+		 */
+		std::vector<std::thread>  lines;
+
+		/**
+		 * Guards the members below.
+		 */
+		std::mutex                lock;
+
+		/**
+		 * Wakes the line threads when a frame is ready or when stopping.
+		 */
+		std::condition_variable   ready;
+
+		/**
+		 * Wakes write() when the last line has finished.
+		 */
+		std::condition_variable   finished;
+
+		/**
+		 * The number of LED units in the frame being sent.
+		 */
+		int                       nLEDs;
+
+		/**
+		 * Counts the frames handed to the line threads, so each thread
+		 * sends each frame once.
+		 */
+		unsigned long             frame;
+
+		/**
+		 * The number of lines still sending the current frame.
+		 */
+		int                       busy;
+
+		/**
+		 * Set to stop the line threads.
+		 */
+		bool                      stopping;
+
+		/**
+		 * Takes as long as one segment of a frame takes on the wire.
+		 *
+		 * @param segment  The index of the segment.
+		 * @param n        The number of LED units in the whole frame.
+		 */
+		void send( int segment, int n );
+
+		/**
+		 * The body of the thread of one data line.
+		 *
+		 * @param segment  The index of the segment the line sends.
+		 */
+		void run( int segment );
+
+	public:
+		/**
+		 * Constructor.
+		 *
+		 * @param segments  The number of data lines, at least 1.
+		 * @param parallel  @b true if the lines send at the same time.
+		 * @param next      The sink the frame is passed on to, or NULL.
+		 */
+		ParallelWireSink( int segments, bool parallel, FrameSink * next = NULL );
+
+		/**
+		 * Destructor.  Stops the line threads.
+		 */
+		virtual ~ParallelWireSink();
+
+		virtual void write( const CRGB * frame, int n );
+};
+
+#endif /* PARALLELWIRESINK_H_ */
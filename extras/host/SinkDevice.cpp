@@ -0,0 +1,30 @@
+/*
+ * SinkDevice.cpp
+ *
+ *  Created on: Oct 18, 2026
+ *      Author: Steven F. LeBrun
+ */
+
+#include "../../BufferDevice.h"
+#include "../../Clock.h"
+#include "SinkDevice.h"
+
+SinkDevice::SinkDevice( int nLEDs, FrameSink * sink ) :
+	LedDevice(nLEDs, BufferDevice_NO_PIN, new CRGB[nLEDs]), colors(leds), sink(sink)
+{
+	fill_solid( colors, nLEDs, CRGB::Black );
+}
+
+SinkDevice::~SinkDevice()
+{
+	delete [] colors;
+}
+
+void SinkDevice::show()
+{
+	unsigned long  start = Clock::micros();
+
+	sink->write( front, maxLEDs );
+
+	showTime.record( Clock::micros() - start );
+}
@@ -0,0 +1,57 @@
+/**
+ * Class derived from LedDevice that sends each frame to a FrameSink from
+ * show(), for the device scheduler, @see DeviceScheduler.
+ *
+ *  @date   Created on October 18, 2026
+ *  @author Steven F. LeBrun
+ *  <br/><br/>
+ */
+
+#ifndef SINKDEVICE_H_
+#define SINKDEVICE_H_
+
+#include "../../LedDevice.h"
+#include "FrameSink.h"
+
+/**
+ * Class derived from LedDevice whose show() writes the frame to a
+ * FrameSink on the thread that rendered it.  Unlike a ThreadedDevice it
+ * has no thread of its own, so hundreds of them can share a few threads.
+ *
+ * The array of colors is allocated by the device.
+ */
+class SinkDevice: public LedDevice
+{
+	private:
+		/**
+		 * The array of colors allocated by the device.
+		 */
+		CRGB *       colors;
+
+		/**
+		 * Where the frames are sent.
+		 */
+		FrameSink *  sink;
+
+	public:
+		/**
+		 * Constructor.
+		 *
+		 * @param nLEDs  The number of LED units in the device.
+		 * @param sink   Where the frames are sent.
+		 */
+		SinkDevice( int nLEDs, FrameSink * sink );
+
+		/**
+		 * Destructor.
+		 */
+		virtual ~SinkDevice();
+
+		/**
+		 * Writes the front buffer to the sink.  The time recorded is the
+		 * time taken to write it.
+		 */
+		virtual void show();
+};
+
+#endif /* SINKDEVICE_H_ */
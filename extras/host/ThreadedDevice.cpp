@@ -0,0 +1,79 @@
+/*
+ * ThreadedDevice.cpp
+ *
+ *  Created on: Oct 18, 2026
+ *      Author: Steven F. LeBrun
+ */
+
+#include <string.h>
+
+#include <chrono>
+
+#include "../../BufferDevice.h"
+#include "../../Clock.h"
+#include "ThreadedDevice.h"
+
+ThreadedDevice::ThreadedDevice( int nLEDs, FrameSink * sink ) :
+	LedDevice(nLEDs, BufferDevice_NO_PIN, new CRGB[nLEDs]), colors(leds), frames(nLEDs), sink(sink),
+	stopping(false), sent(0)
+{
+	fill_solid( colors, nLEDs, CRGB::Black );
+}
+
+ThreadedDevice::~ThreadedDevice()
+{
+	end();
+	delete [] colors;
+}
+
+void ThreadedDevice::begin()
+{
+	if ( ! output.joinable() )
+	{
+		stopping = false;
+		output   = std::thread( &ThreadedDevice::run, this );
+	}
+}
+
+void ThreadedDevice::end()
+{
+	if ( output.joinable() )
+	{
+		stopping = true;
+		output.join();
+	}
+}
+
+void ThreadedDevice::show()
+{
+	unsigned long  start = Clock::micros();
+
+	memcpy( frames.backFrame(), front, maxLEDs * sizeof(CRGB) );
+
+	// The frame is copied anyway, so a device without a back buffer is
+	// dimmed here.  commit() has already dimmed the front buffer of a
+	// double buffered device.
+	if ( level < 255 && front == leds )
+	{
+		nscale8_video( frames.backFrame(), maxLEDs, level );
+	}
+	frames.publish();
+
+	showTime.record( Clock::micros() - start );
+}
+
+void ThreadedDevice::run()
+{
+	while ( ! stopping.load() )
+	{
+		if ( frames.acquire() )
+		{
+			sink->write( frames.frontFrame(), maxLEDs );
+			sent.fetch_add( 1 );
+		}
+		else
+		{
+			std::this_thread::sleep_for( std::chrono::microseconds( 100 ) );
+		}
+	}
+}
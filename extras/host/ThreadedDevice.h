@@ -0,0 +1,113 @@
+/**
+ * Class derived from LedDevice that sends its frames from a thread of its
+ * own, for the host runtime, @see extras/HostRuntime.cpp.
+ *
+ *  @date   Created on October 18, 2026
+ *  @author Steven F. LeBrun
+ *  <br/><br/>
+ */
+
+#ifndef THREADEDDEVICE_H_
+#define THREADEDDEVICE_H_
+
+#include <atomic>
+#include <thread>
+
+#include "../../LedDevice.h"
+#include "FrameSink.h"
+#include "TripleBuffer.h"
+
+/**
+ * Class derived from LedDevice whose show() only hands the frame to an
+ * output thread, through a TripleBuffer, and returns.  The output thread
+ * sends the newest frame to a FrameSink whenever it is free, so a slow
+ * sink costs frames, which are counted, but never slows the light show.
+ *
+ * The array of colors is allocated by the device.
+ */
+class ThreadedDevice: public LedDevice
+{
+	private:
+		/**
+		 * The array of colors allocated by the device.
+		 */
+		CRGB *                      colors;
+
+		/**
+		 * The frames handed from the light show to the output thread.
+		 */
+		TripleBuffer<CRGB>          frames;
+
+		/**
+		 * Where the output thread sends the frames.
+		 */
+		FrameSink *                 sink;
+
+		/**
+		 * The output thread, while running.
+		 */
+		std::thread                 output;
+
+		/**
+		 * Set to stop the output thread.
+		 */
+		std::atomic<bool>           stopping;
+
+		/**
+		 * The number of frames the output thread has sent.
+		 */
+		std::atomic<unsigned long>  sent;
+
+		/**
+		 * The body of the output thread.
+		 */
+		void run();
+
+	public:
+		/**
+		 * Constructor.
+		 *
+		 * @param nLEDs  The number of LED units in the device.
+		 * @param sink   Where the frames are sent.
+		 */
+		ThreadedDevice( int nLEDs, FrameSink * sink );
+
+		/**
+		 * Destructor.  Stops the output thread.
+		 */
+		virtual ~ThreadedDevice();
+
+		/**
+		 * Starts the output thread.
+		 */
+		void begin();
+
+		/**
+		 * Stops the output thread after the frame it is sending.
+		 */
+		void end();
+
+		/**
+		 * Copies the front buffer into the triple buffer and publishes it.
+		 * The time recorded is the time taken to copy.
+		 */
+		virtual void show();
+
+		/**
+		 * @return Returns the number of frames shown by the light show.
+		 */
+		unsigned long renderedFrames() { return frames.publishedFrames(); };
+
+		/**
+		 * @return Returns the number of frames sent by the output thread.
+		 */
+		unsigned long sentFrames() { return sent.load(); };
+
+		/**
+		 * @return Returns the number of frames replaced before the output
+		 *         thread could send them.
+		 */
+		unsigned long droppedFrames() { return frames.droppedFrames(); };
+};
+
+#endif /* THREADEDDEVICE_H_ */
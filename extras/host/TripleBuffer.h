@@ -0,0 +1,162 @@
+/**
+ * Hands frames from one thread to another without locks, for the host
+ * runtime, @see extras/HostRuntime.cpp.
+ *
+ *  @date   Created on October 18, 2026
+ *  @author Steven F. LeBrun
+ *  <br/><br/>
+ */
+
+#ifndef TRIPLEBUFFER_H_
+#define TRIPLEBUFFER_H_
+
+#include <atomic>
+#include <stdint.h>
+
+/**
+ * Set in the shared state when the middle buffer holds a frame the reader
+ * has not taken yet.
+ */
+#define  TripleBuffer_FRESH  0x04
+
+/**
+ * A triple buffer of frames of @b T, for one writer thread and one reader
+ * thread.
+ *
+ * The writer fills the back buffer and publishes it by swapping it with
+ * the middle buffer.  The reader takes the newest frame by swapping its
+ * front buffer with the middle buffer.  Each side owns one buffer at all
+ * times and only the index of the middle one is shared, in a single atomic
+ * byte, so neither side ever waits for the other: a slow reader only
+ * misses frames, which are counted as dropped, and a slow writer only
+ * means the reader sees the same frame for longer.
+ */
+template <class T>
+class TripleBuffer
+{
+	private:
+		/**
+		 * The three frames, each of @b size elements.
+		 */
+		T *                    frames[3];
+
+		/**
+		 * The number of elements in a frame.
+		 */
+		int                    size;
+
+		/**
+		 * The index of the buffer owned by the writer.
+		 */
+		uint8_t                back;
+
+		/**
+		 * The index of the buffer owned by the reader.
+		 */
+		uint8_t                front;
+
+		/**
+		 * The index of the middle buffer, with TripleBuffer_FRESH if it
+		 * holds a frame the reader has not taken.
+		 */
+		std::atomic<uint8_t>   middle;
+
+		/**
+		 * Frames published, and frames replaced before the reader took them.
+		 */
+		std::atomic<unsigned long>  published;
+		std::atomic<unsigned long>  dropped;
+
+	public:
+		/**
+		 * Constructor.
+		 *
+		 * @param size  The number of elements in a frame.
+		 */
+		TripleBuffer( int size ) :
+			size(size), back(0), front(1), middle(2), published(0), dropped(0)
+		{
+			for ( int i = 0 ; i < 3 ; ++i )
+			{
+				frames[i] = new T[size]();
+			}
+		};
+
+		/**
+		 * Destructor.
+		 */
+		~TripleBuffer()
+		{
+			for ( int i = 0 ; i < 3 ; ++i )
+			{
+				delete [] frames[i];
+			}
+		};
+
+		/**
+		 * @return Returns the number of elements in a frame.
+		 */
+		int frameSize() { return size; };
+
+		/**
+		 * @return Returns the frame the writer fills.  Only the writer may
+		 *         call this.
+		 */
+		T * backFrame() { return frames[back]; };
+
+		/**
+		 * Makes the back frame the newest frame.  Only the writer may call
+		 * this.
+		 */
+		void publish()
+		{
+			uint8_t  old = middle.exchange( back | TripleBuffer_FRESH, std::memory_order_acq_rel );
+
+			if ( old & TripleBuffer_FRESH )
+			{
+				dropped.fetch_add( 1, std::memory_order_relaxed );
+			}
+
+			back = old & ~TripleBuffer_FRESH;
+			published.fetch_add( 1, std::memory_order_relaxed );
+		};
+
+		/**
+		 * Takes the newest frame if there is one the reader has not seen.
+		 * Only the reader may call this.
+		 *
+		 * @return Returns @b false if no frame has been published since the
+		 *         last call.
+		 */
+		bool acquire()
+		{
+			if ( ! ( middle.load( std::memory_order_relaxed ) & TripleBuffer_FRESH ) )
+			{
+				return false;
+			}
+
+			uint8_t  old = middle.exchange( front, std::memory_order_acq_rel );
+
+			front = old & ~TripleBuffer_FRESH;
+			return true;
+		};
+
+		/**
+		 * @return Returns the frame last taken by acquire().  Only the reader
+		 *         may call this.
+		 */
+		const T * frontFrame() { return frames[front]; };
+
+		/**
+		 * @return Returns the number of frames published.
+		 */
+		unsigned long publishedFrames() { return published.load(); };
+
+		/**
+		 * @return Returns the number of frames replaced before the reader
+		 *         took them.
+		 */
+		unsigned long droppedFrames() { return dropped.load(); };
+};
+
+#endif /* TRIPLEBUFFER_H_ */